@@ -16,44 +16,188 @@
 #include "UObject/UObjectGlobals.h"
 #include "MixerInteractivityLog.h"
 
+namespace
+{
+	struct FMixerFunctionBinder
+	{
+		struct FParam
+		{
+			UProperty* Property;
+			FString JsonKey;
+			int32 Offset;
+		};
+
+		TArray<FParam> Params;
+
+		// Layout the binder was built from
+		const UProperty* PropertyLink;
+		int32 ParmsSize;
+
+		FMixerFunctionBinder(UFunction* FunctionPrototype)
+			: PropertyLink(FunctionPrototype->PropertyLink)
+			, ParmsSize(FunctionPrototype->ParmsSize)
+		{
+			for (TFieldIterator<UProperty> PropIt(FunctionPrototype); PropIt && (PropIt->PropertyFlags & CPF_Parm); ++PropIt)
+			{
+				if (!PropIt->HasAnyPropertyFlags(CPF_OutParm) || PropIt->HasAnyPropertyFlags(CPF_ReferenceParm))
+				{
+					FParam& Param = Params[Params.AddDefaulted()];
+					Param.Property = *PropIt;
+					Param.JsonKey = PropIt->GetName();
+					Param.Offset = PropIt->GetOffset_ForUFunction();
+				}
+			}
+		}
+
+		bool IsUpToDate(const UFunction* FunctionPrototype) const
+		{
+			return FunctionPrototype->PropertyLink == PropertyLink && FunctionPrototype->ParmsSize == ParmsSize;
+		}
+	};
+
+	struct FMixerClassBinder
+	{
+		// FString keys hash and compare case-insensitively, matching JsonObjectToUStruct
+		TMap<FString, UProperty*> PropertiesByJsonKey;
+		TMap<FName, UFunction*> HandlersByEventType;
+
+		// Layout the binder was built from.  A Blueprint compile regenerates the fields of
+		// the existing class, and the old ones stay alive until the next garbage collection,
+		// so a recompiled class always has a different field list head than the one cached.
+		const UField* Children;
+		const UProperty* PropertyLink;
+		int32 PropertiesSize;
+
+		FMixerClassBinder(const UClass* Class)
+			: Children(Class->Children)
+			, PropertyLink(Class->PropertyLink)
+			, PropertiesSize(Class->GetPropertiesSize())
+		{
+			// Iteration runs from the most derived class up, so the first property seen for a name is the one that hides the rest
+			for (TFieldIterator<UProperty> PropIt(Class); PropIt; ++PropIt)
+			{
+				UProperty*& Property = PropertiesByJsonKey.FindOrAdd(PropIt->GetName());
+				if (Property == nullptr)
+				{
+					Property = *PropIt;
+				}
+			}
+		}
+
+		bool IsUpToDate(const UClass* Class) const
+		{
+			return Class->Children == Children && Class->PropertyLink == PropertyLink && Class->GetPropertiesSize() == PropertiesSize;
+		}
+	};
+
+	template <class ObjectType, class BinderType>
+	BinderType& GetBinder(TMap<TWeakObjectPtr<const ObjectType>, TSharedPtr<BinderType>>& Binders, ObjectType* Object)
+	{
+		TSharedPtr<BinderType>* ExistingBinder = Binders.Find(Object);
+		if (ExistingBinder != nullptr && (*ExistingBinder)->IsUpToDate(Object))
+		{
+			return **ExistingBinder;
+		}
+
+		// Blueprint recompiles leave stale classes and functions behind - drop their binders while we're here
+		for (typename TMap<TWeakObjectPtr<const ObjectType>, TSharedPtr<BinderType>>::TIterator It(Binders); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		// Replaces any binder for an out of date layout of the same object
+		TSharedRef<BinderType> NewBinder = MakeShared<BinderType>(Object);
+		Binders.Add(Object, NewBinder);
+		return *NewBinder;
+	}
+
+	TMap<TWeakObjectPtr<const UFunction>, TSharedPtr<FMixerFunctionBinder>> FunctionBinders;
+	TMap<TWeakObjectPtr<const UClass>, TSharedPtr<FMixerClassBinder>> ClassBinders;
+
+	const FMixerFunctionBinder& GetFunctionBinder(UFunction* FunctionPrototype)
+	{
+		return GetBinder(FunctionBinders, FunctionPrototype);
+	}
+
+	FMixerClassBinder& GetClassBinder(const UClass* Class)
+	{
+		return GetBinder(ClassBinders, Class);
+	}
+}
+
 namespace MixerBindingUtils
 {
+	void FlushBinderCaches()
+	{
+		FunctionBinders.Empty();
+		ClassBinders.Empty();
+	}
+
 	void ExtractCustomEventParamsFromMessage(const FJsonObject* JsonObject, UFunction* FunctionPrototype, void* ParamStorage, SIZE_T ParamStorageSize)
 	{
 		check(ParamStorageSize == FunctionPrototype->ParmsSize);
-		for (TFieldIterator<UProperty> PropIt(FunctionPrototype); PropIt && (PropIt->PropertyFlags & CPF_Parm); ++PropIt)
+		const FMixerFunctionBinder& Binder = GetFunctionBinder(FunctionPrototype);
+		for (const FMixerFunctionBinder::FParam& Param : Binder.Params)
 		{
-			if (!PropIt->HasAnyPropertyFlags(CPF_OutParm) || PropIt->HasAnyPropertyFlags(CPF_ReferenceParm))
+			check(static_cast<SIZE_T>(Param.Offset + Param.Property->GetSize()) <= ParamStorageSize);
+			void* ThisParamStorage = static_cast<uint8*>(ParamStorage) + Param.Offset;
+			Param.Property->InitializeValue(ThisParamStorage);
+			const TSharedPtr<FJsonValue>* F = JsonObject->Values.Find(Param.JsonKey);
+			if (F != nullptr && F->IsValid())
 			{
-				check(static_cast<SIZE_T>(PropIt->GetOffset_ForUFunction() + PropIt->GetSize()) <= ParamStorageSize);
-				void* ThisParamStorage = static_cast<uint8*>(ParamStorage) + PropIt->GetOffset_ForUFunction();
-				PropIt->InitializeValue(ThisParamStorage);
-				TSharedPtr<FJsonValue> F = JsonObject->TryGetField(PropIt->GetName());
-				if (F.IsValid())
+				if (!FJsonObjectConverter::JsonValueToUProperty(*F, Param.Property, ThisParamStorage, 0, 0))
 				{
-					if (!FJsonObjectConverter::JsonValueToUProperty(F, *PropIt, ThisParamStorage, 0, 0))
-					{
-						UE_LOG(LogMixerInteractivity, Error, TEXT("Custom event %s: failed to convert Json value %s for parameter %s"), *FunctionPrototype->GetName(), *F->AsString(), *PropIt->GetName());
-					}
-				}
-				else
-				{
-					UE_LOG(LogMixerInteractivity, Error, TEXT("Custom event %s does not contain expected parameter %s"), *FunctionPrototype->GetName(), *PropIt->GetName());
+					UE_LOG(LogMixerInteractivity, Error, TEXT("Custom event %s: failed to convert Json value %s for parameter %s"), *FunctionPrototype->GetName(), *(*F)->AsString(), *Param.JsonKey);
 				}
 			}
+			else
+			{
+				UE_LOG(LogMixerInteractivity, Error, TEXT("Custom event %s does not contain expected parameter %s"), *FunctionPrototype->GetName(), *Param.JsonKey);
+			}
 		}
 	}
 
 	void DestroyCustomEventParams(UFunction* FunctionPrototype, void* ParamStorage, SIZE_T ParamStorageSize)
 	{
-		for (TFieldIterator<UProperty> PropIt(FunctionPrototype); PropIt && (PropIt->PropertyFlags & CPF_Parm); ++PropIt)
+		const FMixerFunctionBinder& Binder = GetFunctionBinder(FunctionPrototype);
+		for (const FMixerFunctionBinder::FParam& Param : Binder.Params)
+		{
+			check(static_cast<SIZE_T>(Param.Offset + Param.Property->GetSize()) <= ParamStorageSize);
+			Param.Property->DestroyValue(static_cast<uint8*>(ParamStorage) + Param.Offset);
+		}
+	}
+
+	UFunction* FindCustomEventHandler(const UObject* Target, FName EventType)
+	{
+		FMixerClassBinder& Binder = GetClassBinder(Target->GetClass());
+		UFunction** CachedHandler = Binder.HandlersByEventType.Find(EventType);
+		if (CachedHandler != nullptr)
 		{
-			if (!PropIt->HasAnyPropertyFlags(CPF_OutParm) || PropIt->HasAnyPropertyFlags(CPF_ReferenceParm))
+			return *CachedHandler;
+		}
+
+		UFunction* Handler = Target->FindFunction(EventType);
+		Binder.HandlersByEventType.Add(EventType, Handler);
+		return Handler;
+	}
+
+	void ApplyPropertyUpdatesFromMessage(const FJsonObject* JsonObject, UObject* Target)
+	{
+		const FMixerClassBinder& Binder = GetClassBinder(Target->GetClass());
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : JsonObject->Values)
+		{
+			UProperty* const* Property = Binder.PropertiesByJsonKey.Find(Field.Key);
+			if (Property != nullptr && Field.Value.IsValid())
 			{
-				check(static_cast<SIZE_T>(PropIt->GetOffset_ForUFunction() + PropIt->GetSize()) <= ParamStorageSize);
-				void* ThisParamStorage = static_cast<uint8*>(ParamStorage) + PropIt->GetOffset_ForUFunction();
-				PropIt->DestroyValue(ThisParamStorage);
+				void* Value = (*Property)->ContainerPtrToValuePtr<void>(Target);
+				if (!FJsonObjectConverter::JsonValueToUProperty(Field.Value, *Property, Value, 0, 0))
+				{
+					UE_LOG(LogMixerInteractivity, Error, TEXT("Custom control %s: failed to convert Json value %s for property %s"), *Target->GetName(), *Field.Value->AsString(), *Field.Key);
+				}
 			}
 		}
 	}
-}
\ No newline at end of file
+}
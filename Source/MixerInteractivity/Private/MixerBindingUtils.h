@@ -11,6 +11,9 @@
 
 #include "HAL/Platform.h"
 
+#include "UObject/NameTypes.h"
+
+class UObject;
 class UFunction;
 class FJsonObject;
 
@@ -18,4 +21,31 @@ namespace MixerBindingUtils
 {
 	void ExtractCustomEventParamsFromMessage(const FJsonObject* JsonObject, UFunction* FunctionPrototype, void* ParamStorage, SIZE_T ParamStorageSize);
 	void DestroyCustomEventParams(UFunction* FunctionPrototype, void* ParamStorage, SIZE_T ParamStorageSize);
+
+	/**
+	* Find the UFUNCTION on Target's class that handles the named custom control event.
+	* Lookups (including misses) are cached per class.
+	*
+	* @param	Target		Object whose class should be searched.
+	* @param	EventType	Name of the custom control event.
+	*
+	* @Return	The handler function, or nullptr if the class does not provide one.
+	*/
+	UFunction* FindCustomEventHandler(const UObject* Target, FName EventType);
+
+	/**
+	* Apply a set of updated properties received from the service to Target.
+	* Only the properties named in the message are touched; keys are matched
+	* to properties case-insensitively.
+	*
+	* @param	JsonObject	Message containing the updated property values.
+	* @param	Target		Object whose properties should be updated.
+	*/
+	void ApplyPropertyUpdatesFromMessage(const FJsonObject* JsonObject, UObject* Target);
+
+	/**
+	* Forget cached property and function lookups.  Must be called before fields that may
+	* have been cached are freed, e.g. before garbage collection following a Blueprint compile.
+	*/
+	void FlushBinderCaches();
 }
@@ -0,0 +1,234 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+
+#include "MixerBlueprintEventRouter.h"
+#include "MixerDynamicDelegateBinding.h"
+#include "Modules/ModuleManager.h"
+#include "Engine/World.h"
+
+namespace
+{
+	template <class TargetArrayType, class DispatchFuncType>
+	void DispatchToTargets(const TargetArrayType* Targets, DispatchFuncType Dispatch)
+	{
+		if (Targets != nullptr)
+		{
+			// Blueprint handlers may add bindings (and therefore routes) while we're dispatching
+			TargetArrayType TargetsCopy = *Targets;
+			for (const TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>& Target : TargetsCopy)
+			{
+				UMixerInteractivityBlueprintEventSource* Source = Target.Get();
+				if (Source != nullptr)
+				{
+					Dispatch(Source);
+				}
+			}
+		}
+	}
+}
+
+FMixerBlueprintEventRouter& FMixerBlueprintEventRouter::Get()
+{
+	static FMixerBlueprintEventRouter Router;
+	return Router;
+}
+
+FMixerBlueprintEventRouter::FMixerBlueprintEventRouter()
+	: bBoundToModule(false)
+{
+}
+
+void FMixerBlueprintEventRouter::AddSource(UMixerInteractivityBlueprintEventSource* Source)
+{
+	UWorld* World = Source->GetWorld();
+	if (World != nullptr)
+	{
+		TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>* ExistingSource = SourcesByWorld.Find(World);
+		if (ExistingSource == nullptr || !ExistingSource->IsValid())
+		{
+			SourcesByWorld.Add(World, Source);
+		}
+	}
+}
+
+void FMixerBlueprintEventRouter::RemoveSource(UMixerInteractivityBlueprintEventSource* Source)
+{
+	for (TMap<TWeakObjectPtr<UWorld>, TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>>::TIterator It(SourcesByWorld); It; ++It)
+	{
+		if (!It->Key.IsValid() || !It->Value.IsValid() || It->Value.Get() == Source)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (TMap<FName, FRouteTargets>& RouteMap : Routes)
+	{
+		for (TMap<FName, FRouteTargets>::TIterator It(RouteMap); It; ++It)
+		{
+			It->Value.Remove(Source);
+			if (It->Value.Num() == 0)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	ParticipantStateTargets.Remove(Source);
+	BroadcastingStateTargets.Remove(Source);
+	PendingBatchSources.Remove(Source);
+}
+
+UMixerInteractivityBlueprintEventSource* FMixerBlueprintEventRouter::FindSourceForWorld(UWorld* World) const
+{
+	const TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>* ExistingSource = SourcesByWorld.Find(World);
+	return ExistingSource != nullptr ? ExistingSource->Get() : nullptr;
+}
+
+void FMixerBlueprintEventRouter::AddRoute(EMixerBlueprintEventRoute Route, FName Name, UMixerInteractivityBlueprintEventSource* Source)
+{
+	check(Route < EMixerBlueprintEventRoute::Count);
+	AddTarget(Routes[static_cast<int32>(Route)].FindOrAdd(Name), Source);
+	BindToModule();
+}
+
+void FMixerBlueprintEventRouter::AddParticipantStateRoute(UMixerInteractivityBlueprintEventSource* Source)
+{
+	AddTarget(ParticipantStateTargets, Source);
+	BindToModule();
+}
+
+void FMixerBlueprintEventRouter::AddBroadcastingStateRoute(UMixerInteractivityBlueprintEventSource* Source)
+{
+	AddTarget(BroadcastingStateTargets, Source);
+	BindToModule();
+}
+
+void FMixerBlueprintEventRouter::AddPendingBatchSource(UMixerInteractivityBlueprintEventSource* Source)
+{
+	PendingBatchSources.AddUnique(Source);
+}
+
+bool FMixerBlueprintEventRouter::Tick(float DeltaTime)
+{
+	if (PendingBatchSources.Num() > 0)
+	{
+		// Sources re-add themselves if their handlers generate input that needs another flush
+		FRouteTargets SourcesToFlush;
+		Swap(SourcesToFlush, PendingBatchSources);
+		for (const TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>& Target : SourcesToFlush)
+		{
+			UMixerInteractivityBlueprintEventSource* Source = Target.Get();
+			if (Source != nullptr)
+			{
+				Source->FlushBatchedEvents();
+			}
+		}
+	}
+
+	return true;
+}
+
+void FMixerBlueprintEventRouter::AddTarget(FRouteTargets& Targets, UMixerInteractivityBlueprintEventSource* Source)
+{
+	// Drop sources from worlds that have since been torn down
+	Targets.RemoveAll([](const TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>& Target) { return !Target.IsValid(); });
+	Targets.AddUnique(Source);
+}
+
+const FMixerBlueprintEventRouter::FRouteTargets* FMixerBlueprintEventRouter::FindTargets(EMixerBlueprintEventRoute Route, FName Name) const
+{
+	return Routes[static_cast<int32>(Route)].Find(Name);
+}
+
+void FMixerBlueprintEventRouter::BindToModule()
+{
+	if (!bBoundToModule)
+	{
+		// Use GetModuleChecked here to avoid unsafe non-game thread warning
+		IMixerInteractivityModule& InteractivityModule = FModuleManager::GetModuleChecked<IMixerInteractivityModule>("MixerInteractivity");
+		InteractivityModule.OnButtonEvent().AddRaw(this, &FMixerBlueprintEventRouter::OnButtonEvent);
+		InteractivityModule.OnStickEvent().AddRaw(this, &FMixerBlueprintEventRouter::OnStickEvent);
+		InteractivityModule.OnTextboxSubmitEvent().AddRaw(this, &FMixerBlueprintEventRouter::OnTextboxSubmitEvent);
+		InteractivityModule.OnCustomControlInput().AddRaw(this, &FMixerBlueprintEventRouter::OnCustomControlInput);
+		InteractivityModule.OnCustomControlPropertyUpdate().AddRaw(this, &FMixerBlueprintEventRouter::OnCustomControlPropertyUpdate);
+		InteractivityModule.OnCustomMethodCall().AddRaw(this, &FMixerBlueprintEventRouter::OnCustomMethodCall);
+		InteractivityModule.OnParticipantsChanged().AddRaw(this, &FMixerBlueprintEventRouter::OnParticipantsChanged);
+		InteractivityModule.OnBroadcastingStateChanged().AddRaw(this, &FMixerBlueprintEventRouter::OnBroadcastingStateChanged);
+		bBoundToModule = true;
+	}
+}
+
+void FMixerBlueprintEventRouter::OnButtonEvent(FName ButtonName, TSharedPtr<const FMixerRemoteUser> Participant, const FMixerButtonEventDetails& Details)
+{
+	DispatchToTargets(FindTargets(EMixerBlueprintEventRoute::Button, ButtonName), [&](UMixerInteractivityBlueprintEventSource* Source)
+	{
+		Source->OnButtonNativeEvent(ButtonName, Participant, Details);
+	});
+}
+
+void FMixerBlueprintEventRouter::OnStickEvent(FName StickName, TSharedPtr<const FMixerRemoteUser> Participant, FVector2D StickValue)
+{
+	DispatchToTargets(FindTargets(EMixerBlueprintEventRoute::Stick, StickName), [&](UMixerInteractivityBlueprintEventSource* Source)
+	{
+		Source->OnStickNativeEvent(StickName, Participant, StickValue);
+	});
+}
+
+void FMixerBlueprintEventRouter::OnTextboxSubmitEvent(FName TextboxName, TSharedPtr<const FMixerRemoteUser> Participant, const FMixerTextboxEventDetails& Details)
+{
+	DispatchToTargets(FindTargets(EMixerBlueprintEventRoute::Textbox, TextboxName), [&](UMixerInteractivityBlueprintEventSource* Source)
+	{
+		Source->OnTextboxSubmitNativeEvent(TextboxName, Participant, Details);
+	});
+}
+
+void FMixerBlueprintEventRouter::OnCustomControlInput(FName ControlName, FName EventType, TSharedPtr<const FMixerRemoteUser> Participant, const TSharedRef<FJsonObject> EventPayload)
+{
+	DispatchToTargets(FindTargets(EMixerBlueprintEventRoute::CustomControl, ControlName), [&](UMixerInteractivityBlueprintEventSource* Source)
+	{
+		Source->OnCustomControlInputNativeEvent(ControlName, EventType, Participant, EventPayload);
+	});
+}
+
+void FMixerBlueprintEventRouter::OnCustomControlPropertyUpdate(FName ControlName, const TSharedRef<FJsonObject> UpdatedProperties)
+{
+	DispatchToTargets(FindTargets(EMixerBlueprintEventRoute::CustomControl, ControlName), [&](UMixerInteractivityBlueprintEventSource* Source)
+	{
+		Source->OnCustomControlPropertyUpdateNativeEvent(ControlName, UpdatedProperties);
+	});
+}
+
+void FMixerBlueprintEventRouter::OnCustomMethodCall(FName MethodName, const TSharedPtr<FJsonObject> MethodParams)
+{
+	DispatchToTargets(FindTargets(EMixerBlueprintEventRoute::CustomMethod, MethodName), [&](UMixerInteractivityBlueprintEventSource* Source)
+	{
+		Source->OnCustomMethodCallNativeEvent(MethodName, MethodParams);
+	});
+}
+
+void FMixerBlueprintEventRouter::OnParticipantsChanged(TArrayView<const TSharedPtr<const FMixerRemoteUser>> Participants, EMixerInteractivityParticipantState NewState)
+{
+	// Blueprint events are per participant, but resolving targets once per batch saves work during raids
+	DispatchToTargets(&ParticipantStateTargets, [&](UMixerInteractivityBlueprintEventSource* Source)
+	{
+		for (const TSharedPtr<const FMixerRemoteUser>& Participant : Participants)
+		{
+			Source->OnParticipantStateChangedNativeEvent(Participant, NewState);
+		}
+	});
+}
+
+void FMixerBlueprintEventRouter::OnBroadcastingStateChanged(bool NewBroadcastingState)
+{
+	DispatchToTargets(&BroadcastingStateTargets, [&](UMixerInteractivityBlueprintEventSource* Source)
+	{
+		Source->OnBroadcastingStateChangedNativeEvent(NewBroadcastingState);
+	});
+}
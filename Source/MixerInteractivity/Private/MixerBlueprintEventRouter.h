@@ -0,0 +1,87 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "MixerInteractivityModule.h"
+#include "Containers/Map.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Containers/Ticker.h"
+
+class UWorld;
+class UMixerInteractivityBlueprintEventSource;
+
+enum class EMixerBlueprintEventRoute : uint8
+{
+	Button,
+	Stick,
+	Textbox,
+	CustomControl,
+	CustomMethod,
+
+	Count
+};
+
+/**
+* Single subscriber to the interactivity module's events on behalf of all
+* Blueprint event sources.  Keeps a table of which sources are interested in
+* which controls so that each event is only delivered to the sources that
+* bound something to it, and maps worlds to their event source.
+* Also drives once-per-frame delivery of batched Blueprint events.
+*/
+class FMixerBlueprintEventRouter : public FTickerObjectBase
+{
+public:
+	static FMixerBlueprintEventRouter& Get();
+
+	/** Register Source as the event source for its world (if there isn't one already). */
+	void AddSource(UMixerInteractivityBlueprintEventSource* Source);
+
+	/** Remove Source from the world map and from every route. */
+	void RemoveSource(UMixerInteractivityBlueprintEventSource* Source);
+
+	UMixerInteractivityBlueprintEventSource* FindSourceForWorld(UWorld* World) const;
+
+	/** Route events of the given kind for the named control (or method) to Source. */
+	void AddRoute(EMixerBlueprintEventRoute Route, FName Name, UMixerInteractivityBlueprintEventSource* Source);
+
+	void AddParticipantStateRoute(UMixerInteractivityBlueprintEventSource* Source);
+	void AddBroadcastingStateRoute(UMixerInteractivityBlueprintEventSource* Source);
+
+	/** Request a call to Source->FlushBatchedEvents at the end of the frame. */
+	void AddPendingBatchSource(UMixerInteractivityBlueprintEventSource* Source);
+
+	virtual bool Tick(float DeltaTime) override;
+
+private:
+	typedef TArray<TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>, TInlineAllocator<2>> FRouteTargets;
+
+	FMixerBlueprintEventRouter();
+
+	void BindToModule();
+	static void AddTarget(FRouteTargets& Targets, UMixerInteractivityBlueprintEventSource* Source);
+	const FRouteTargets* FindTargets(EMixerBlueprintEventRoute Route, FName Name) const;
+
+	void OnButtonEvent(FName ButtonName, TSharedPtr<const FMixerRemoteUser> Participant, const FMixerButtonEventDetails& Details);
+	void OnStickEvent(FName StickName, TSharedPtr<const FMixerRemoteUser> Participant, FVector2D StickValue);
+	void OnTextboxSubmitEvent(FName TextboxName, TSharedPtr<const FMixerRemoteUser> Participant, const FMixerTextboxEventDetails& Details);
+	void OnCustomControlInput(FName ControlName, FName EventType, TSharedPtr<const FMixerRemoteUser> Participant, const TSharedRef<FJsonObject> EventPayload);
+	void OnCustomControlPropertyUpdate(FName ControlName, const TSharedRef<FJsonObject> UpdatedProperties);
+	void OnCustomMethodCall(FName MethodName, const TSharedPtr<FJsonObject> MethodParams);
+	void OnParticipantsChanged(TArrayView<const TSharedPtr<const FMixerRemoteUser>> Participants, EMixerInteractivityParticipantState NewState);
+	void OnBroadcastingStateChanged(bool NewBroadcastingState);
+
+private:
+	TMap<FName, FRouteTargets> Routes[static_cast<int32>(EMixerBlueprintEventRoute::Count)];
+	FRouteTargets ParticipantStateTargets;
+	FRouteTargets BroadcastingStateTargets;
+	FRouteTargets PendingBatchSources;
+	TMap<TWeakObjectPtr<UWorld>, TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>> SourcesByWorld;
+	bool bBoundToModule;
+};
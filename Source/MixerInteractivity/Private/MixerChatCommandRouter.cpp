@@ -0,0 +1,318 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerChatCommandRouter.h"
+#include "MixerInteractivitySettings.h"
+#include "MixerInteractivityLog.h"
+#include "OnlineChatMixerPrivate.h"
+
+namespace
+{
+	const int32 MinUserTablePruneThreshold = 64;
+	const int32 MinPendingCommandSlots = 16;
+}
+
+FMixerChatCommandRouter::FMixerChatCommandRouter()
+	: PendingHead(0)
+	, PendingNum(0)
+	, BaseTime(FPlatformTime::Seconds())
+{
+	// Root
+	FTrieNode& Root = Nodes[Nodes.AddUninitialized()];
+	Root.Char = 0;
+	Root.FirstChild = INDEX_NONE;
+	Root.NextSibling = INDEX_NONE;
+	Root.CommandIndex = INDEX_NONE;
+}
+
+bool FMixerChatCommandRouter::RegisterCommand(const FString& Command, FTimespan PerUserCooldown, FTimespan CommandCooldown, const FOnMixerChatCommand& Handler)
+{
+	if (Command.IsEmpty() || !Handler.IsBound())
+	{
+		return false;
+	}
+
+	for (const TCHAR Char : Command)
+	{
+		if (FChar::IsWhitespace(Char))
+		{
+			UE_LOG(LogMixerChat, Error, TEXT("Chat command '%s' may not contain whitespace"), *Command);
+			return false;
+		}
+	}
+
+	int32 Node = 0;
+	for (const TCHAR Char : Command)
+	{
+		Node = FindOrAddChild(Node, FChar::ToLower(Char));
+	}
+
+	int32 CommandIndex = Nodes[Node].CommandIndex;
+	if (CommandIndex == INDEX_NONE)
+	{
+		CommandIndex = Commands.AddDefaulted();
+		Nodes[Node].CommandIndex = CommandIndex;
+	}
+	else if (Commands[CommandIndex].Handler.IsBound())
+	{
+		UE_LOG(LogMixerChat, Warning, TEXT("Replacing existing handler for chat command '%s'"), *Command);
+	}
+
+	FCommand& NewCommand = Commands[CommandIndex];
+	NewCommand.Handler = Handler;
+	NewCommand.PerUserCooldown = static_cast<float>(PerUserCooldown.GetTotalSeconds());
+	NewCommand.CommandCooldown = static_cast<float>(CommandCooldown.GetTotalSeconds());
+	NewCommand.NextAvailableTime = 0.0f;
+	NewCommand.UserLastUsedTime.Empty();
+	NewCommand.PruneThreshold = MinUserTablePruneThreshold;
+	return true;
+}
+
+bool FMixerChatCommandRouter::UnregisterCommand(const FString& Command)
+{
+	// The trie node is left in place (it's tiny) so that re-registering reuses it.
+	int32 Node = FindCommandNode(Command);
+	if (Node == INDEX_NONE || !Commands[Nodes[Node].CommandIndex].Handler.IsBound())
+	{
+		return false;
+	}
+
+	FCommand& OldCommand = Commands[Nodes[Node].CommandIndex];
+	OldCommand.Handler.Unbind();
+	OldCommand.UserLastUsedTime.Empty();
+	return true;
+}
+
+void FMixerChatCommandRouter::RouteMessage(const FChatRoomId& RoomId, const TSharedRef<FChatMessageMixerImpl>& Message)
+{
+	if (Message->IsAction() || Message->GetNumFragments() == 0 || Commands.Num() == 0)
+	{
+		return;
+	}
+
+	// Cheap rejection before the flat body gets built.
+	FMixerChatMessageFragment FirstFragment = Message->GetFragment(0);
+	if (FirstFragment.TextLength == 0 || FindChild(0, FChar::ToLower(FirstFragment.Text[0])) == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Longest registered command that ends at a word boundary
+	const FString& Body = Message->GetBody();
+	const TCHAR* BodyChars = *Body;
+	int32 Node = 0;
+	int32 MatchedCommand = INDEX_NONE;
+	int32 MatchedLength = 0;
+	for (int32 i = 0; i < Body.Len(); ++i)
+	{
+		Node = FindChild(Node, FChar::ToLower(BodyChars[i]));
+		if (Node == INDEX_NONE)
+		{
+			break;
+		}
+
+		const int32 CommandIndex = Nodes[Node].CommandIndex;
+		if (CommandIndex != INDEX_NONE && Commands[CommandIndex].Handler.IsBound() && (i + 1 == Body.Len() || FChar::IsWhitespace(BodyChars[i + 1])))
+		{
+			MatchedCommand = CommandIndex;
+			MatchedLength = i + 1;
+		}
+	}
+
+	if (MatchedCommand == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (!TryUseCommand(Commands[MatchedCommand], Message->GetSender().Id))
+	{
+		UE_LOG(LogMixerChat, VeryVerbose, TEXT("Ignoring chat command from %s in room %s: on cooldown"), *Message->GetNickname(), *RoomId);
+		return;
+	}
+
+	FPendingCommand& NewPending = AddPending();
+	NewPending.CommandIndex = MatchedCommand;
+	NewPending.RoomId = RoomId;
+	NewPending.Message = Message;
+	Tokenize(BodyChars + MatchedLength, NewPending);
+}
+
+bool FMixerChatCommandRouter::Tick(float DeltaTime)
+{
+	const int32 CommandsPerFrame = GetDefault<UMixerInteractivitySettings>()->ChatCommandsPerFrame;
+	int32 NumToDispatch = CommandsPerFrame > 0 ? FMath::Min(CommandsPerFrame, PendingNum) : PendingNum;
+	while (NumToDispatch-- > 0 && PendingNum > 0)
+	{
+		FPendingCommand& Next = Pending[PendingHead];
+		PendingHead = (PendingHead + 1) % Pending.Num();
+		--PendingNum;
+
+		// Take what the handler needs out of the slot: it may register commands or route
+		// messages itself, either of which can reallocate our arrays.  Swapping argument
+		// buffers with DispatchArguments keeps them circulating without reallocation.
+		FOnMixerChatCommand Handler = Commands[Next.CommandIndex].Handler;
+		TSharedPtr<FChatMessageMixerImpl> Message = MoveTemp(Next.Message);
+		FChatRoomId RoomId = Next.RoomId;
+		const int32 NumArguments = Next.NumArguments;
+		Swap(DispatchArguments, Next.Arguments);
+
+		Handler.ExecuteIfBound(RoomId, *Message, TArrayView<const FString>(DispatchArguments.GetData(), NumArguments));
+	}
+
+	return true;
+}
+
+int32 FMixerChatCommandRouter::FindChild(int32 Node, TCHAR Char) const
+{
+	for (int32 Child = Nodes[Node].FirstChild; Child != INDEX_NONE; Child = Nodes[Child].NextSibling)
+	{
+		if (Nodes[Child].Char == Char)
+		{
+			return Child;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FMixerChatCommandRouter::FindOrAddChild(int32 Node, TCHAR Char)
+{
+	int32 Child = FindChild(Node, Char);
+	if (Child == INDEX_NONE)
+	{
+		Child = Nodes.AddUninitialized();
+		Nodes[Child].Char = Char;
+		Nodes[Child].FirstChild = INDEX_NONE;
+		Nodes[Child].NextSibling = Nodes[Node].FirstChild;
+		Nodes[Child].CommandIndex = INDEX_NONE;
+		Nodes[Node].FirstChild = Child;
+	}
+	return Child;
+}
+
+int32 FMixerChatCommandRouter::FindCommandNode(const FString& Command) const
+{
+	int32 Node = 0;
+	for (const TCHAR Char : Command)
+	{
+		Node = FindChild(Node, FChar::ToLower(Char));
+		if (Node == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+	}
+	return Nodes[Node].CommandIndex != INDEX_NONE ? Node : INDEX_NONE;
+}
+
+bool FMixerChatCommandRouter::TryUseCommand(FCommand& Command, int32 UserId)
+{
+	const float Now = static_cast<float>(FPlatformTime::Seconds() - BaseTime);
+	if (Now < Command.NextAvailableTime)
+	{
+		return false;
+	}
+
+	if (Command.PerUserCooldown > 0.0f)
+	{
+		float* LastUsedTime = Command.UserLastUsedTime.Find(UserId);
+		if (LastUsedTime != nullptr)
+		{
+			if (Now - *LastUsedTime < Command.PerUserCooldown)
+			{
+				return false;
+			}
+			*LastUsedTime = Now;
+		}
+		else
+		{
+			if (Command.UserLastUsedTime.Num() >= Command.PruneThreshold)
+			{
+				for (TMap<int32, float>::TIterator It(Command.UserLastUsedTime); It; ++It)
+				{
+					if (Now - It->Value >= Command.PerUserCooldown)
+					{
+						It.RemoveCurrent();
+					}
+				}
+				Command.PruneThreshold = FMath::Max(MinUserTablePruneThreshold, Command.UserLastUsedTime.Num() * 2);
+			}
+			Command.UserLastUsedTime.Add(UserId, Now);
+		}
+	}
+
+	Command.NextAvailableTime = Now + Command.CommandCooldown;
+	return true;
+}
+
+void FMixerChatCommandRouter::Tokenize(const TCHAR* Arguments, FPendingCommand& OutPending) const
+{
+	// Words are split on whitespace.  If there are more words than the configured
+	// maximum then the final argument holds the remainder of the line.
+	const int32 MaxArguments = FMath::Max(GetDefault<UMixerInteractivitySettings>()->MaxChatCommandArguments, 1);
+	if (OutPending.Arguments.Num() < MaxArguments)
+	{
+		OutPending.Arguments.SetNum(MaxArguments);
+	}
+
+	OutPending.NumArguments = 0;
+	const TCHAR* Cursor = Arguments;
+	while (*Cursor != 0)
+	{
+		while (FChar::IsWhitespace(*Cursor))
+		{
+			++Cursor;
+		}
+
+		if (*Cursor == 0)
+		{
+			break;
+		}
+
+		const TCHAR* WordStart = Cursor;
+		if (OutPending.NumArguments + 1 == MaxArguments)
+		{
+			Cursor += FCString::Strlen(Cursor);
+			while (Cursor > WordStart && FChar::IsWhitespace(*(Cursor - 1)))
+			{
+				--Cursor;
+			}
+		}
+		else
+		{
+			while (*Cursor != 0 && !FChar::IsWhitespace(*Cursor))
+			{
+				++Cursor;
+			}
+		}
+
+		FString& Argument = OutPending.Arguments[OutPending.NumArguments++];
+		Argument.Reset();
+		Argument.AppendChars(WordStart, static_cast<int32>(Cursor - WordStart));
+	}
+}
+
+FMixerChatCommandRouter::FPendingCommand& FMixerChatCommandRouter::AddPending()
+{
+	if (PendingNum == Pending.Num())
+	{
+		// Full: unroll the ring into a larger array, oldest first
+		TArray<FPendingCommand> Grown;
+		Grown.Reserve(FMath::Max(Pending.Num() * 2, MinPendingCommandSlots));
+		for (int32 i = 0; i < PendingNum; ++i)
+		{
+			Grown.Add(MoveTemp(Pending[(PendingHead + i) % Pending.Num()]));
+		}
+		Grown.SetNum(Grown.Max());
+		Pending = MoveTemp(Grown);
+		PendingHead = 0;
+	}
+
+	FPendingCommand& Slot = Pending[(PendingHead + PendingNum) % Pending.Num()];
+	++PendingNum;
+	return Slot;
+}
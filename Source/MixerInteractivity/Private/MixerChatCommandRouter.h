@@ -0,0 +1,89 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineChatMixer.h"
+#include "Containers/Ticker.h"
+
+struct FChatMessageMixerImpl;
+
+/**
+* Matches incoming chat messages against registered commands ("!attack left") and
+* dispatches matches to their handlers in per-frame batches.
+* Command names are stored in a case-insensitive character trie so that ordinary chat
+* is usually rejected after looking at its first character.  Arguments are tokenized
+* into string buffers that are recycled between messages.
+*/
+class FMixerChatCommandRouter : public FTickerObjectBase
+{
+public:
+	FMixerChatCommandRouter();
+
+	bool RegisterCommand(const FString& Command, FTimespan PerUserCooldown, FTimespan CommandCooldown, const FOnMixerChatCommand& Handler);
+	bool UnregisterCommand(const FString& Command);
+
+	/** Check a newly received message for a command, queueing it for dispatch if it matches and is not on cooldown */
+	void RouteMessage(const FChatRoomId& RoomId, const TSharedRef<FChatMessageMixerImpl>& Message);
+
+	// FTickerObjectBase
+	virtual bool Tick(float DeltaTime) override;
+
+private:
+	struct FTrieNode
+	{
+		TCHAR Char;
+		int32 FirstChild;
+		int32 NextSibling;
+		int32 CommandIndex;
+	};
+
+	struct FCommand
+	{
+		FOnMixerChatCommand Handler;
+		float PerUserCooldown;
+		float CommandCooldown;
+		float NextAvailableTime;
+
+		// Seconds since router creation at which each user last successfully used this command.
+		// Expired entries are pruned whenever the table doubles in size.
+		TMap<int32, float> UserLastUsedTime;
+		int32 PruneThreshold;
+	};
+
+	struct FPendingCommand
+	{
+		int32 CommandIndex;
+		FChatRoomId RoomId;
+		TSharedPtr<FChatMessageMixerImpl> Message;
+		TArray<FString> Arguments;
+		int32 NumArguments;
+	};
+
+	int32 FindChild(int32 Node, TCHAR Char) const;
+	int32 FindOrAddChild(int32 Node, TCHAR Char);
+	int32 FindCommandNode(const FString& Command) const;
+	bool TryUseCommand(FCommand& Command, int32 UserId);
+	void Tokenize(const TCHAR* Arguments, FPendingCommand& OutPending) const;
+	FPendingCommand& AddPending();
+
+private:
+	TArray<FTrieNode> Nodes;
+	TArray<FCommand> Commands;
+
+	// Ring buffer of matched commands awaiting dispatch.  Slots, and the argument
+	// strings inside them, are reused rather than freed once dispatched.
+	TArray<FPendingCommand> Pending;
+	int32 PendingHead;
+	int32 PendingNum;
+	TArray<FString> DispatchArguments;
+
+	double BaseTime;
+};
@@ -12,6 +12,7 @@
 #include "MixerInteractivityModule.h"
 #include "MixerInteractivityTypes.h"
 #include "MixerInteractivityUserSettings.h"
+#include "MixerInteractivitySettings.h"
 #include "OnlineChatMixer.h"
 #include "OnlineChatMixerPrivate.h"
 #include "MixerJsonHelpers.h"
@@ -29,18 +30,47 @@
 
 DEFINE_LOG_CATEGORY(LogMixerChat);
 
+namespace
+{
+	// Most messages the chat service will return from a single history request
+	const int32 MaxHistoryRequestSize = 100;
+
+	// ClampMin on the setting is only enforced by the editor, and hand-edited config may say 0
+	float GetChatSendRate(const UMixerInteractivitySettings* Settings)
+	{
+		return FMath::Max(Settings->ChatSendRatePerSecond, 0.01f);
+	}
+}
+
 FMixerChatConnection::FMixerChatConnection(FOnlineChatMixer* InChatInterface, const FUniqueNetId& UserId, const FChatRoomId& InRoomId, const FChatRoomConfig& Config)
 	: TMixerWebSocketOwnerBase<FMixerChatConnection>(MixerStringConstants::MessageTypes::Event, MixerStringConstants::FieldNames::Event, MixerStringConstants::FieldNames::Data)
 	, ChatInterface(InChatInterface)
 	, User(UserId.AsShared())
 	, RoomId(InRoomId)
-	, ChannelId(0)
+	, CachedUsers(GetDefault<UMixerInteractivitySettings>()->ChatUserCacheSize)
+	, ChatHistoryNext(0)
 	, ChatHistoryNum(0)
-	, ChatHistoryMax(10) // @TODO: pull from config once available
+	, ChannelId(0)
+	, bHasHeldIngestItem(false)
+	, bUsingCachedServerInfo(false)
+	, SendTokens(static_cast<float>(GetDefault<UMixerInteractivitySettings>()->ChatSendBurst))
+	, LastSendTokenRefillTime(FPlatformTime::Seconds())
 	, bIsReady(false)
 	, bRejoinOnDisconnect(Config.bRejoinOnDisconnect)
 {
 	FMemory::Memzero(Permissions);
+
+	// FChatRoomConfig is engine-defined, so history size comes from project settings
+	const int32 ChatHistoryCapacity = FMath::Max(GetDefault<UMixerInteractivitySettings>()->ChatHistorySize, 0);
+	ChatHistory.SetNum(ChatHistoryCapacity);
+	ChatHistorySlotById.Reserve(ChatHistoryCapacity);
+
+	if (GetDefault<UMixerInteractivitySettings>()->bParseChatOffGameThread && FPlatformProcess::SupportsMultithreading())
+	{
+		IngestPipeline = MakeShared<FMixerChatIngestPipeline, ESPMode::ThreadSafe>();
+	}
+
+	SetModerationFilter(ChatInterface->GetModerationFilter());
 }
 
 FMixerChatConnection::~FMixerChatConnection()
@@ -50,12 +80,7 @@ FMixerChatConnection::~FMixerChatConnection()
 bool FMixerChatConnection::Init()
 {
 #if WITH_WEBSOCKETS
-	TSharedRef<IHttpRequest> ChannelRequest = FHttpModule::Get().CreateRequest();
-	ChannelRequest->SetVerb(TEXT("GET"));
-	ChannelRequest->SetURL(FString::Printf(TEXT("https://mixer.com/api/v1/channels/%s"), *RoomId));
-
-	ChannelRequest->OnProcessRequestComplete().BindSP(this, &FMixerChatConnection::OnGetChannelInfoForRoomIdComplete);
-	return ChannelRequest->ProcessRequest();
+	return ChatInterface->GetDiscoveryCache()->ResolveChannelId(RoomId, FOnMixerChannelIdResolved::CreateSP(this, &FMixerChatConnection::OnChannelIdResolved));
 #else
 	UE_LOG(LogMixerChat, Warning, TEXT("Mixer chat requires websockets which are not available on this platform."));
 	return false;
@@ -64,24 +89,14 @@ bool FMixerChatConnection::Init()
 
 void FMixerChatConnection::JoinDiscoveredChatChannel()
 {
-	TSharedRef<IHttpRequest> ChatRequest = FHttpModule::Get().CreateRequest();
-	ChatRequest->SetVerb(TEXT("GET"));
-	ChatRequest->SetURL(FString::Printf(TEXT("https://mixer.com/api/v1/chats/%d?fields=id"), ChannelId));
-
-	// Setting Authorization header to an empty string will just fail rather than perform anonymous auth.
 	const UMixerInteractivityUserSettings* UserSettings = GetDefault<UMixerInteractivityUserSettings>();
 	FString AuthZHeaderValue = UserSettings->GetAuthZHeaderValue();
-	if (AuthZHeaderValue.Len() > 0)
-	{
-		ChatRequest->SetHeader(TEXT("Authorization"), AuthZHeaderValue);
-	}
-	else
+	if (AuthZHeaderValue.Len() == 0)
 	{
 		UE_LOG(LogMixerChat, Warning, TEXT("No auth token found.  Chat connection will be anonymous and will not allow sending messages.  Sign in to Mixer to enable."));
 	}
 
-	ChatRequest->OnProcessRequestComplete().BindSP(this, &FMixerChatConnection::OnDiscoverChatServersComplete);
-	if (!ChatRequest->ProcessRequest())
+	if (!ChatInterface->GetDiscoveryCache()->ResolveChatServers(ChannelId, AuthZHeaderValue, FOnMixerChatServersResolved::CreateSP(this, &FMixerChatConnection::OnChatServersResolved)))
 	{
 		ChatInterface->ConnectAttemptFinished(*User, RoomId, false, TEXT("Failed to send request for chat web socket connection info."));
 
@@ -89,23 +104,9 @@ void FMixerChatConnection::JoinDiscoveredChatChannel()
 	}
 }
 
-void FMixerChatConnection::OnGetChannelInfoForRoomIdComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+void FMixerChatConnection::OnChannelIdResolved(int32 InChannelId)
 {
-	if (bSucceeded && HttpResponse.IsValid())
-	{
-		if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
-		{
-			FString ResponseStr = HttpResponse->GetContentAsString();
-			TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
-			TSharedPtr<FJsonObject> JsonObject;
-			if (FJsonSerializer::Deserialize(JsonReader, JsonObject) &&
-				JsonObject.IsValid())
-			{
-				JsonObject->TryGetNumberField(MixerStringConstants::FieldNames::Id, ChannelId);
-			}
-		}
-	}
-
+	ChannelId = InChannelId;
 	if (ChannelId != 0)
 	{
 		JoinDiscoveredChatChannel();
@@ -118,48 +119,31 @@ void FMixerChatConnection::OnGetChannelInfoForRoomIdComplete(FHttpRequestPtr Htt
 	}
 }
 
-void FMixerChatConnection::OnDiscoverChatServersComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
+void FMixerChatConnection::OnChatServersResolved(TSharedPtr<const FMixerChatServerInfo> ServerInfo, bool bFromCache)
 {
 	FMemory::Memzero(Permissions);
+	Endpoints.Empty();
+	AuthKey.Empty();
+	bUsingCachedServerInfo = bFromCache;
 
-	if (bSucceeded && HttpResponse.IsValid())
+	if (ServerInfo.IsValid())
 	{
-		if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
-		{
-			FString ResponseStr = HttpResponse->GetContentAsString();
-			TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
-			TSharedPtr<FJsonObject> JsonObject;
-			if (FJsonSerializer::Deserialize(JsonReader, JsonObject) &&
-				JsonObject.IsValid())
-			{
-				const TArray<TSharedPtr<FJsonValue>> *JsonEndpoints;
-				if (JsonObject->TryGetArrayField(MixerStringConstants::FieldNames::Endpoints, JsonEndpoints))
-				{
-					for (const TSharedPtr<FJsonValue>& Endpoint : *JsonEndpoints)
-					{
-						Endpoints.Add(Endpoint->AsString());
-					}
-
-					JsonObject->TryGetStringField(MixerStringConstants::FieldNames::AuthKey, AuthKey);
-					const TArray<TSharedPtr<FJsonValue>>* JsonPermissions;
-					if (JsonObject->TryGetArrayField(MixerStringConstants::FieldNames::Permissions, JsonPermissions))
-					{
-						Permissions.bConnect = JsonPermissions->ContainsByPredicate([](const TSharedPtr<FJsonValue>& V) { return V->AsString() == MixerStringConstants::Permissions::Connect; });
-						Permissions.bChat = JsonPermissions->ContainsByPredicate([](const TSharedPtr<FJsonValue>& V) { return V->AsString() == MixerStringConstants::Permissions::Chat; });
-						Permissions.bWhisper = JsonPermissions->ContainsByPredicate([](const TSharedPtr<FJsonValue>& V) { return V->AsString() == MixerStringConstants::Permissions::Chat; });
-						Permissions.bPollStart = JsonPermissions->ContainsByPredicate([](const TSharedPtr<FJsonValue>& V) { return V->AsString() == MixerStringConstants::Permissions::PollStart; });
-						Permissions.bPollVote = JsonPermissions->ContainsByPredicate([](const TSharedPtr<FJsonValue>& V) { return V->AsString() == MixerStringConstants::Permissions::PollVote; });
-						Permissions.bClearMessages = JsonPermissions->ContainsByPredicate([](const TSharedPtr<FJsonValue>& V) { return V->AsString() == MixerStringConstants::Permissions::ClearMessages; });
-						Permissions.bPurge = JsonPermissions->ContainsByPredicate([](const TSharedPtr<FJsonValue>& V) { return V->AsString() == MixerStringConstants::Permissions::Purge; });
-						Permissions.bGiveawayStart = JsonPermissions->ContainsByPredicate([](const TSharedPtr<FJsonValue>& V) { return V->AsString() == MixerStringConstants::Permissions::GiveawayStart; });
-					}
-				}
-			}
-		}
+		Endpoints = ServerInfo->Endpoints;
+		AuthKey = ServerInfo->AuthKey;
+
+		const TArray<FString>& PermissionNames = ServerInfo->Permissions;
+		Permissions.bConnect = PermissionNames.Contains(MixerStringConstants::Permissions::Connect);
+		Permissions.bChat = PermissionNames.Contains(MixerStringConstants::Permissions::Chat);
+		Permissions.bWhisper = PermissionNames.Contains(MixerStringConstants::Permissions::Chat);
+		Permissions.bPollStart = PermissionNames.Contains(MixerStringConstants::Permissions::PollStart);
+		Permissions.bPollVote = PermissionNames.Contains(MixerStringConstants::Permissions::PollVote);
+		Permissions.bClearMessages = PermissionNames.Contains(MixerStringConstants::Permissions::ClearMessages);
+		Permissions.bPurge = PermissionNames.Contains(MixerStringConstants::Permissions::Purge);
+		Permissions.bGiveawayStart = PermissionNames.Contains(MixerStringConstants::Permissions::GiveawayStart);
 	}
 
 	// Should have a web socket going by now.
-	if (Permissions.bConnect)
+	if (Permissions.bConnect && Endpoints.Num() > 0)
 	{
 		const FString& SelectedEndpoint = Endpoints[FMath::RandRange(0, Endpoints.Num() - 1)];
 		UE_LOG(LogMixerChat, Verbose, TEXT("Opening web socket to %s for chat room %s"), *SelectedEndpoint, *RoomId);
@@ -201,8 +185,25 @@ void FMixerChatConnection::HandleSocketClosed(bool bWasClean)
 
 	bool bWasReady = bIsReady;
 
+	// Nothing may be sent until the replacement socket has authenticated again
+	bIsReady = false;
+
 	if (bRejoinOnDisconnect)
 	{
+		RequeueInFlightSends();
+
+		if (IngestPipeline.IsValid())
+		{
+			// Frames still being parsed belong to the dead socket.  Let the old pipeline drain on its own,
+			// but take the vote back first - this waits out any count its worker is part way through.
+			IngestPipeline->SetActiveVote(nullptr);
+			IngestPipeline = MakeShared<FMixerChatIngestPipeline, ESPMode::ThreadSafe>();
+			IngestPipeline->SetActiveVote(ActiveChatVote);
+			IngestPipeline->SetModerationFilter(ModerationFilter);
+		}
+		HeldIngestItem = FMixerChatIngestItem();
+		bHasHeldIngestItem = false;
+
 		UE_LOG(LogMixerChat, Warning, TEXT("Attempting automatic reconnect to %s."), *RoomId);
 		const FString& NewRandomEndpoint = Endpoints[FMath::RandRange(0, Endpoints.Num() - 1)];
 		TMap<FString, FString> EmptyHeaders;
@@ -239,57 +240,78 @@ bool FMixerChatConnection::HandleWelcomeEvent(class FJsonObject* JsonObj)
 
 bool FMixerChatConnection::HandleChatMessageEvent(FJsonObject* JsonObj)
 {
-	TSharedPtr<FChatMessageMixerImpl> ChatMessage;
-	bool bHandled = HandleChatMessageEventInternal(JsonObj, ChatMessage);
+	FMixerParsedChatMessage ParsedMessage;
+	if (!MixerChatIngest::ParseChatMessage(JsonObj, ParsedMessage))
+	{
+		return false;
+	}
 
-	if (bHandled)
+	// When chat is parsed off the game thread the ingest pipeline moderates and counts votes instead.
+	// Moderation comes first so that blocked messages never count as votes.
+	if (ModerationFilter.IsValid())
 	{
-		check(ChatMessage.IsValid());
-		if (ChatMessage->IsWhisper())
-		{
-			UE_LOG(LogMixerChat, Verbose, TEXT("Private message from %s: %s"), *ChatMessage->GetNickname(), *ChatMessage->GetBody());
-			ChatInterface->TriggerOnChatPrivateMessageReceivedDelegates(*User, ChatMessage.ToSharedRef());
-		}
-		else
-		{
-			UE_LOG(LogMixerChat, Verbose, TEXT("Chat message from %s in room %s: %s"), *ChatMessage->GetNickname(), *RoomId, *ChatMessage->GetBody());
-			AddMessageToChatHistory(ChatMessage.ToSharedRef());
-			ChatInterface->TriggerOnChatRoomMessageReceivedDelegates(*User, RoomId, ChatMessage.ToSharedRef());
-		}
+		ParsedMessage.bIsFiltered = ModerationFilter->Apply(ParsedMessage.Content);
+	}
+
+	// The vote has a single writer, so never count here while a pipeline exists even if a frame reaches us
+	if (!IngestPipeline.IsValid() && ActiveChatVote.IsValid() && !ParsedMessage.bIsWhisper && !ParsedMessage.bIsFiltered &&
+		ParsedMessage.Content.Num() > 0 && ActiveChatVote->CountVote(ParsedMessage.UserId, ParsedMessage.Content.GetFragment(0)) &&
+		ActiveChatVote->ConsumesVoteMessages())
+	{
+		return true;
 	}
 
-	return bHandled;
+	TSharedPtr<FChatMessageMixerImpl> ChatMessage = BuildChatMessage(ParsedMessage);
+	if (!ChatMessage.IsValid())
+	{
+		return false;
+	}
+
+	DeliverChatMessage(ChatMessage.ToSharedRef());
+	return true;
 }
 
-bool FMixerChatConnection::HandleChatMessageEventInternal(FJsonObject* JsonObj, TSharedPtr<FChatMessageMixerImpl>& OutChatMessage)
+void FMixerChatConnection::DeliverChatMessage(TSharedRef<FChatMessageMixerImpl> ChatMessage)
 {
-	GET_JSON_INT_RETURN_FAILURE(UserIdWithUnderscore, FromUserIdRaw);
-	GET_JSON_OBJECT_RETURN_FAILURE(Message, MessageJson);
-	GET_JSON_STRING_RETURN_FAILURE(Id, IdString);
-
-	FGuid MessageGuid;
-	if (!FGuid::Parse(IdString, MessageGuid))
+	if (ChatMessage->IsWhisper())
 	{
-		UE_LOG(LogMixerChat, Error, TEXT("id field %s for chat event was not in the expected format (guid)"), *IdString);
-		return false;
+		UE_LOG(LogMixerChat, Verbose, TEXT("Private message from %s: %s"), *ChatMessage->GetNickname(), *ChatMessage->GetBody());
+		ChatInterface->TriggerOnChatPrivateMessageReceivedDelegates(*User, ChatMessage);
+		ChatInterface->RouteChatCommand(RoomId, ChatMessage);
 	}
+	else
+	{
+		UE_LOG(LogMixerChat, Verbose, TEXT("Chat message from %s in room %s: %s"), *ChatMessage->GetNickname(), *RoomId, *ChatMessage->GetBody());
+		AddMessageToChatHistory(ChatMessage);
+		ChatInterface->TriggerOnChatRoomMessageReceivedDelegates(*User, RoomId, ChatMessage);
+		ChatInterface->RouteChatCommand(RoomId, ChatMessage);
+	}
+}
 
-	FUniqueNetIdMixer FromNetIdLocal = FUniqueNetIdMixer(FromUserIdRaw);
-	TSharedPtr<FMixerChatUser>* FromUserObject = CachedUsers.Find(FromNetIdLocal);
+TSharedPtr<FChatMessageMixerImpl> FMixerChatConnection::BuildChatMessage(FMixerParsedChatMessage& ParsedMessage)
+{
+	FUniqueNetIdMixer FromNetIdLocal = FUniqueNetIdMixer(ParsedMessage.UserId);
+	TSharedPtr<FMixerChatUser> FromUserObject = CachedUsers.Find(FromNetIdLocal);
 	bool bSendJoinEvent = false;
-	if (FromUserObject == nullptr)
+	if (!FromUserObject.IsValid())
 	{
-		GET_JSON_STRING_RETURN_FAILURE(UserNameWithUnderscore, FromUserName);
-
-		TSharedRef<FMixerChatUser> NewUser = MakeShared<FMixerChatUser>(FromUserName, FromUserIdRaw);
-		FromUserObject = &CachedUsers.Add(FromNetIdLocal, NewUser);
+		if (ParsedMessage.UserName.IsEmpty())
+		{
+			UE_LOG(LogMixerChat, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::UserNameWithUnderscore);
+			return nullptr;
+		}
 
-		// We haven't seen this user before - send a just-in-time join event,
-		// but wait until after we have resolved the user level
-		bSendJoinEvent = true;
+		// We haven't seen this user before (or they were evicted and their join already announced) -
+		// send a just-in-time join event, but wait until after we have resolved the user level
+		bSendJoinEvent = !CachedUsers.WasEvicted(FromNetIdLocal);
+		FromUserObject = CachedUsers.Add(FromNetIdLocal, ParsedMessage.UserName, ParsedMessage.UserId);
+	}
+	check(FromUserObject.IsValid());
+	if (ParsedMessage.bHasUserLevel)
+	{
+		FromUserObject->Level = ParsedMessage.UserLevel;
 	}
-	check(FromUserObject);
-	if (!JsonObj->TryGetNumberField(MixerStringConstants::FieldNames::UserLevel, (*FromUserObject)->Level))
+	else
 	{
 		// This one's less serious.
 		UE_LOG(LogMixerChat, Warning, TEXT("Missing user_level field for chat event"));
@@ -297,59 +319,185 @@ bool FMixerChatConnection::HandleChatMessageEventInternal(FJsonObject* JsonObj,
 
 	if (bSendJoinEvent)
 	{
-		UE_LOG(LogMixerChat, Log, TEXT("%s is joining %s's chat channel"), *(*FromUserObject)->Name, *RoomId);
+		UE_LOG(LogMixerChat, Log, TEXT("%s is joining %s's chat channel"), *FromUserObject->Name, *RoomId);
+
+		ChatInterface->TriggerOnChatRoomMemberJoinDelegates(*User, RoomId, FromUserObject->GetUniqueNetId());
+	}
+
+	TSharedRef<FChatMessageMixerImpl> ChatMessage = MakeShared<FChatMessageMixerImpl>(ParsedMessage.MessageId, FromUserObject.ToSharedRef(), MoveTemp(ParsedMessage.Content));
+
+	if (ParsedMessage.bIsWhisper)
+	{
+		ChatMessage->FlagAsWhisper();
+	}
+
+	if (ParsedMessage.bIsAction)
+	{
+		ChatMessage->FlagAsAction();
+	}
 
-		ChatInterface->TriggerOnChatRoomMemberJoinDelegates(*User, RoomId, (*FromUserObject)->GetUniqueNetId());
+	if (ParsedMessage.bIsFiltered)
+	{
+		ChatMessage->FlagAsFiltered();
 	}
 
-	OutChatMessage = MakeShared<FChatMessageMixerImpl>(MessageGuid, FromUserObject->ToSharedRef());
-	return HandleChatMessageEventMessageObject(MessageJson->Get(), OutChatMessage.Get());
+	return ChatMessage;
 }
 
-bool FMixerChatConnection::HandleChatMessageEventMessageObject(FJsonObject* JsonObj, FChatMessageMixerImpl* ChatMessage)
+bool FMixerChatConnection::DeferSocketMessage(const FString& MessageJsonString)
 {
-	GET_JSON_ARRAY_RETURN_FAILURE(Message, MessageFragmentArray);
+	if (!IngestPipeline.IsValid())
+	{
+		return false;
+	}
 
-	for (const TSharedPtr<FJsonValue>& Fragment : *MessageFragmentArray)
+	IngestPipeline->Enqueue(MessageJsonString);
+	return true;
+}
+
+bool FMixerChatConnection::Tick(float DeltaTime)
+{
+	if (IngestPipeline.IsValid())
 	{
-		const TSharedPtr<FJsonObject>* FragmentObj;
-		if (Fragment->TryGetObject(FragmentObj))
+		DeliverIngestedMessages();
+	}
+
+	PumpSendQueue();
+	return true;
+}
+
+void FMixerChatConnection::DeliverIngestedMessages()
+{
+	// Handlers may cause the interface to drop this connection
+	TSharedRef<FMixerChatConnection> KeepAlive = AsShared();
+
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	const int32 Budget = Settings->ChatMessagesPerFrame > 0 ? Settings->ChatMessagesPerFrame : MAX_int32;
+	const int32 Backlog = IngestPipeline->GetNumQueuedChatMessages() + (bHasHeldIngestItem ? 1 : 0);
+	const EMixerChatOverloadPolicy Policy = Backlog > Budget ? Settings->ChatOverloadPolicy : EMixerChatOverloadPolicy::DeliverAll;
+	const int32 SampleStride = Policy == EMixerChatOverloadPolicy::Sample ? FMath::DivideAndRoundUp(Backlog, Budget) : 1;
+
+	int32 NumChatMessagesTaken = 0;
+	int32 NumRoomMessagesSeen = 0;
+	int32 NumRoomMessagesDelivered = 0;
+	TArray<TSharedRef<FChatMessage>> Digest;
+
+	while (bHasHeldIngestItem || IngestPipeline->Dequeue(HeldIngestItem))
+	{
+		bHasHeldIngestItem = true;
+		if (HeldIngestItem.bIsChatMessage)
+		{
+			if (Policy != EMixerChatOverloadPolicy::DeliverAll && NumChatMessagesTaken >= Backlog)
+			{
+				// The stride was sized for the backlog at the start of the frame - anything that
+				// arrived since waits for the next frame rather than extending this one.
+				break;
+			}
+			++NumChatMessagesTaken;
+
+			const bool bIsRoomMessage = !HeldIngestItem.ChatMessage.bIsWhisper;
+			if (bIsRoomMessage && Policy == EMixerChatOverloadPolicy::DeliverAll && NumRoomMessagesDelivered >= Budget)
+			{
+				// Leave it held for the next frame
+				break;
+			}
+
+			TSharedPtr<FChatMessageMixerImpl> ChatMessage = BuildChatMessage(HeldIngestItem.ChatMessage);
+			if (ChatMessage.IsValid())
+			{
+				bool bDeliver = true;
+				if (bIsRoomMessage)
+				{
+					switch (Policy)
+					{
+					case EMixerChatOverloadPolicy::Sample:
+						bDeliver = NumRoomMessagesSeen % SampleStride == 0 && NumRoomMessagesDelivered < Budget;
+						break;
+					case EMixerChatOverloadPolicy::Coalesce:
+						bDeliver = NumRoomMessagesDelivered < Budget;
+						break;
+					default:
+						break;
+					}
+					++NumRoomMessagesSeen;
+				}
+
+				if (bDeliver)
+				{
+					DeliverChatMessage(ChatMessage.ToSharedRef());
+					NumRoomMessagesDelivered += bIsRoomMessage ? 1 : 0;
+				}
+				else
+				{
+					AddMessageToChatHistory(ChatMessage.ToSharedRef());
+					ChatInterface->RouteChatCommand(RoomId, ChatMessage.ToSharedRef());
+					if (Policy == EMixerChatOverloadPolicy::Coalesce)
+					{
+						Digest.Add(ChatMessage.ToSharedRef());
+					}
+				}
+			}
+		}
+		else if (HeldIngestItem.Json.IsValid())
 		{
-			HandleChatMessageEventMessageArrayEntry(FragmentObj->Get(), ChatMessage);
+			if (!DispatchSocketMessage(HeldIngestItem.Json.Get()))
+			{
+				UE_LOG(LogMixerChat, Warning, TEXT("Failed to handle websocket message from server for chat room %s"), *RoomId);
+			}
 		}
+
+		HeldIngestItem = FMixerChatIngestItem();
+		bHasHeldIngestItem = false;
 	}
 
-	// These are not required.
-	const TSharedPtr<FJsonObject>* Metadata;
-	bool bIsWhisper = false;
-	bool bIsAction = false;
-	if (JsonObj->TryGetObjectField(MixerStringConstants::FieldNames::Meta, Metadata))
+	if (Digest.Num() > 0)
 	{
-		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Whisper, bIsWhisper);
-		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Me, bIsAction);
+		UE_LOG(LogMixerChat, Verbose, TEXT("Coalesced %d chat messages in room %s"), Digest.Num(), *RoomId);
+		ChatInterface->TriggerOnChatRoomMessageDigestDelegates(*User, RoomId, Digest);
 	}
+}
 
-	if (bIsWhisper)
+void FMixerChatConnection::StartChatVote(const TArray<FString>& Options, bool bConsumeVoteMessages)
+{
+	ActiveChatVote = MakeShared<FMixerChatVote, ESPMode::ThreadSafe>(Options, bConsumeVoteMessages);
+	if (IngestPipeline.IsValid())
 	{
-		ChatMessage->FlagAsWhisper();
+		IngestPipeline->SetActiveVote(ActiveChatVote);
 	}
+}
 
-	if (bIsAction)
+void FMixerChatConnection::SetModerationFilter(const TSharedPtr<const FMixerChatModerationFilter, ESPMode::ThreadSafe>& Filter)
+{
+	ModerationFilter = Filter;
+	if (IngestPipeline.IsValid())
 	{
-		ChatMessage->FlagAsAction();
+		IngestPipeline->SetModerationFilter(Filter);
+	}
+}
+
+bool FMixerChatConnection::StopChatVote()
+{
+	if (!ActiveChatVote.IsValid())
+	{
+		return false;
 	}
 
+	ActiveChatVote.Reset();
+	if (IngestPipeline.IsValid())
+	{
+		IngestPipeline->SetActiveVote(nullptr);
+	}
 	return true;
 }
 
-bool FMixerChatConnection::HandleChatMessageEventMessageArrayEntry(FJsonObject* JsonObj, FChatMessageMixerImpl* ChatMessage)
+bool FMixerChatConnection::GetChatVoteTally(TArray<int32>& OutVotes) const
 {
-	GET_JSON_STRING_RETURN_FAILURE(Type, FragmentType);
-	GET_JSON_STRING_RETURN_FAILURE(Text, FragmentText);
+	if (!ActiveChatVote.IsValid())
+	{
+		return false;
+	}
 
-	// For now just always append the fragment text no matter the type.
-	// In the future we could perhaps add markup?
-	ChatMessage->AppendBodyFragment(FragmentText);
+	ActiveChatVote->GetTally(OutVotes);
 	return true;
 }
 
@@ -358,18 +506,22 @@ bool FMixerChatConnection::HandleUserJoinEvent(FJsonObject* JsonObj)
 	GET_JSON_INT_RETURN_FAILURE(Id, JoiningUserIdRaw);
 
 	FUniqueNetIdMixer JoiningNetId = FUniqueNetIdMixer(JoiningUserIdRaw);
-	TSharedPtr<FMixerChatUser>* CachedUser = CachedUsers.Find(JoiningNetId);
+	TSharedPtr<FMixerChatUser> CachedUser = CachedUsers.Find(JoiningNetId);
 
 	// If the user was already in the cache then we triggered a join event at the
 	// point of addition (presumably a chat message reached us before join?).  Don't
 	// send another.
-	if (CachedUser == nullptr)
+	if (!CachedUser.IsValid())
 	{
 		GET_JSON_STRING_RETURN_FAILURE(UserNameNoUnderscore, JoiningUserName);
-		CachedUser = &CachedUsers.Add(JoiningNetId, MakeShared<FMixerChatUser>(JoiningUserName, JoiningUserIdRaw));
+		const bool bAlreadyAnnounced = CachedUsers.WasEvicted(JoiningNetId);
+		CachedUser = CachedUsers.Add(JoiningNetId, JoiningUserName, JoiningUserIdRaw);
 
-		UE_LOG(LogMixerChat, Log, TEXT("%s is joining %s's chat channel"), *(*CachedUser)->Name, *RoomId);
-		ChatInterface->TriggerOnChatRoomMemberJoinDelegates(*User, RoomId, (*CachedUser)->GetUniqueNetId());
+		if (!bAlreadyAnnounced)
+		{
+			UE_LOG(LogMixerChat, Log, TEXT("%s is joining %s's chat channel"), *CachedUser->Name, *RoomId);
+			ChatInterface->TriggerOnChatRoomMemberJoinDelegates(*User, RoomId, CachedUser->GetUniqueNetId());
+		}
 	}
 
 	return true;
@@ -380,16 +532,22 @@ bool FMixerChatConnection::HandleUserLeaveEvent(FJsonObject* JsonObj)
 	GET_JSON_INT_RETURN_FAILURE(Id, LeavingUserIdRaw);
 
 	FUniqueNetIdMixer LeavingNetId = FUniqueNetIdMixer(LeavingUserIdRaw);
-	TSharedPtr<FMixerChatUser> LeavingUser;
-
 	// If we never cached the user then we never triggered a join event, in which
 	// case we shouldn't trigger leave either.
-	if (CachedUsers.RemoveAndCopyValue(LeavingNetId, LeavingUser))
+	TSharedPtr<FMixerChatUser> LeavingUser = CachedUsers.Remove(LeavingNetId);
+	if (LeavingUser.IsValid())
 	{
 		UE_LOG(LogMixerChat, Log, TEXT("%s is exiting %s's chat channel"), *LeavingUser->Name, *RoomId);
 
 		ChatInterface->TriggerOnChatRoomMemberExitDelegates(*User, RoomId, LeavingUser->GetUniqueNetId());
 	}
+	else if (CachedUsers.RemoveEvicted(LeavingNetId))
+	{
+		// We announced their join but have since dropped them from the cache
+		UE_LOG(LogMixerChat, Log, TEXT("User %d is exiting %s's chat channel"), LeavingUserIdRaw, *RoomId);
+
+		ChatInterface->TriggerOnChatRoomMemberExitDelegates(*User, RoomId, LeavingNetId);
+	}
 
 	return true;
 }
@@ -405,24 +563,19 @@ bool FMixerChatConnection::HandleDeleteMessageEvent(FJsonObject* JsonObj)
 		return false;
 	}
 
-	DeleteFromChatHistoryIf([&MessageGuid](TSharedPtr<FChatMessageMixerImpl> ChatMessage)
-	{
-		return ChatMessage->GetMessageId() == MessageGuid;
-	});
+	DeleteFromChatHistory(MessageGuid);
 
 	return true;
 }
 
 bool FMixerChatConnection::HandleClearMessagesEvent(FJsonObject* JsonObj)
 {
-	DeleteFromChatHistoryIf([](TSharedPtr<FChatMessageMixerImpl>)
+	DeleteFromChatHistoryIf([](const FChatMessageMixerImpl&)
 	{
 		return true;
 	});
 
-	check(ChatHistoryNum == 0);
-	check(!ChatHistoryNewest.IsValid());
-	check(!ChatHistoryOldest.IsValid());
+	check(ChatHistorySlotById.Num() == 0);
 
 	ChatInterface->TriggerOnChatRoomMessagesClearedDelegates(*User, RoomId);
 
@@ -433,9 +586,9 @@ bool FMixerChatConnection::HandlePurgeMessageEvent(FJsonObject* JsonObj)
 {
 	GET_JSON_INT_RETURN_FAILURE(UserIdWithUnderscore, UserId);
 
-	DeleteFromChatHistoryIf([UserId](TSharedPtr<FChatMessageMixerImpl> ChatMessage)
+	DeleteFromChatHistoryIf([UserId](const FChatMessageMixerImpl& ChatMessage)
 	{
-		return ChatMessage->GetSender().Id == UserId;
+		return ChatMessage.GetSender().Id == UserId;
 	});
 
 	ChatInterface->TriggerOnChatRoomUserPurgedDelegates(*User, RoomId, FUniqueNetIdMixer(UserId));
@@ -474,10 +627,10 @@ bool FMixerChatConnection::HandlePollStartEvent(FJsonObject* JsonObj)
 		}
 
 		FUniqueNetIdMixer AskingUserId = FUniqueNetIdMixer(AskingUserIdRaw);
-		TSharedPtr<FMixerChatUser>* CachedUser = CachedUsers.Find(AskingUserId);
+		TSharedPtr<FMixerChatUser> CachedUser = CachedUsers.Find(AskingUserId);
 
 		// If the user is not already in the cache then we'll inject a join event.
-		if (CachedUser == nullptr)
+		if (!CachedUser.IsValid())
 		{
 			FString AskingUsername;
 			if (!(*Author)->TryGetStringField(MixerStringConstants::FieldNames::UserNameWithUnderscore, AskingUsername))
@@ -485,15 +638,19 @@ bool FMixerChatConnection::HandlePollStartEvent(FJsonObject* JsonObj)
 				UE_LOG(LogMixerChat, Error, TEXT("Missing required %s field in json payload"), *MixerStringConstants::FieldNames::UserNameWithUnderscore);
 				return false;
 			}
-			CachedUser = &CachedUsers.Add(AskingUserId, MakeShared<FMixerChatUser>(AskingUsername, AskingUserIdRaw));
+			const bool bAlreadyAnnounced = CachedUsers.WasEvicted(AskingUserId);
+			CachedUser = CachedUsers.Add(AskingUserId, AskingUsername, AskingUserIdRaw);
 
-			UE_LOG(LogMixerChat, Log, TEXT("%s is joining %s's chat channel"), *(*CachedUser)->Name, *RoomId);
-			ChatInterface->TriggerOnChatRoomMemberJoinDelegates(*User, RoomId, (*CachedUser)->GetUniqueNetId());
+			if (!bAlreadyAnnounced)
+			{
+				UE_LOG(LogMixerChat, Log, TEXT("%s is joining %s's chat channel"), *CachedUser->Name, *RoomId);
+				ChatInterface->TriggerOnChatRoomMemberJoinDelegates(*User, RoomId, CachedUser->GetUniqueNetId());
+			}
 		}
 
-		(*Author)->TryGetNumberField(MixerStringConstants::FieldNames::UserLevel, (*CachedUser)->Level);
+		(*Author)->TryGetNumberField(MixerStringConstants::FieldNames::UserLevel, CachedUser->Level);
 
-		ActivePoll = MakeShared<FChatPollMixerImpl>(CachedUser->ToSharedRef(), Question, EndsAt);
+		ActivePoll = MakeShared<FChatPollMixerImpl>(CachedUser.ToSharedRef(), Question, EndsAt);
 		bIsNewPoll = true;
 
 		ActivePoll->Answers.SetNum(Answers->Num());
@@ -612,7 +769,7 @@ bool FMixerChatConnection::SendChatMessage(const FString& MessageBody)
 		return false;
 	}
 
-	SendMethodMessageArrayParams(MixerStringConstants::MethodNames::Msg, nullptr, MessageBody);
+	EnqueueSend(ESendPriority::Chat, FString(), MessageBody, NAME_None);
 
 	return true;
 }
@@ -637,8 +794,184 @@ bool FMixerChatConnection::SendWhisper(const FString& ToUser, const FString& Mes
 		return false;
 	}
 
-	SendMethodMessageArrayParams(MixerStringConstants::MethodNames::Whisper, nullptr, ToUser, MessageBody);
+	EnqueueSend(ESendPriority::Whisper, ToUser, MessageBody, NAME_None);
+
+	return true;
+}
+
+bool FMixerChatConnection::SendAnnouncement(FName Key, const FString& MessageBody)
+{
+	if (!bIsReady)
+	{
+		UE_LOG(LogMixerChat, Warning, TEXT("Attempt to send chat to room %s before connection has been established.  Wait for OnChatRoomJoin event."), *RoomId);
+		return false;
+	}
+
+	if (IsAnonymous())
+	{
+		UE_LOG(LogMixerChat, Warning, TEXT("Attempt to send chat to room %s when connected anonymously."), *RoomId);
+		return false;
+	}
+
+	if (!Permissions.bChat)
+	{
+		UE_LOG(LogMixerChat, Warning, TEXT("No permission to send chat in room %s."), *RoomId);
+		return false;
+	}
+
+	EnqueueSend(ESendPriority::Announcement, FString(), MessageBody, Key);
+
+	return true;
+}
+
+void FMixerChatConnection::EnqueueSend(ESendPriority Priority, const FString& Recipient, const FString& Body, FName CoalesceKey)
+{
+	TArray<FQueuedSend>& Queue = SendQueues[static_cast<int32>(Priority)];
+	if (CoalesceKey != NAME_None)
+	{
+		for (FQueuedSend& Pending : Queue)
+		{
+			if (Pending.CoalesceKey == CoalesceKey)
+			{
+				Pending.Body = Body;
+				++SendStats.NumCoalesced;
+				return;
+			}
+		}
+	}
+
+	const int32 QueueLimit = FMath::Max(GetDefault<UMixerInteractivitySettings>()->ChatSendQueueLimit, 1);
+	if (SendStats.NumQueued >= QueueLimit)
+	{
+		// Make room by dropping the oldest message of the lowest priority that has any,
+		// unless that would mean dropping something more important than the new message.
+		int32 DropFrom = static_cast<int32>(ESendPriority::Count) - 1;
+		while (SendQueues[DropFrom].Num() == 0)
+		{
+			--DropFrom;
+		}
+
+		++SendStats.NumDropped;
+		if (DropFrom < static_cast<int32>(Priority))
+		{
+			UE_LOG(LogMixerChat, Warning, TEXT("Outgoing chat queue for room %s is full.  Dropping message."), *RoomId);
+			return;
+		}
+
+		UE_LOG(LogMixerChat, Warning, TEXT("Outgoing chat queue for room %s is full.  Dropping oldest queued message."), *RoomId);
+		SendQueues[DropFrom].RemoveAt(0, 1, false);
+		--SendStats.NumQueued;
+	}
+
+	FQueuedSend& NewSend = Queue[Queue.AddDefaulted()];
+	NewSend.Priority = Priority;
+	NewSend.Recipient = Recipient;
+	NewSend.Body = Body;
+	NewSend.CoalesceKey = CoalesceKey;
+	NewSend.NumAttempts = 0;
+	NewSend.NotBefore = 0.0;
+	++SendStats.NumQueued;
+
+	// Go out immediately if the bucket allows
+	PumpSendQueue();
+}
+
+void FMixerChatConnection::PumpSendQueue()
+{
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	const double Now = FPlatformTime::Seconds();
+	const float MaxTokens = static_cast<float>(FMath::Max(Settings->ChatSendBurst, 1));
+	SendTokens = FMath::Min(MaxTokens, SendTokens + static_cast<float>(Now - LastSendTokenRefillTime) * GetChatSendRate(Settings));
+	LastSendTokenRefillTime = Now;
+
+	if (SendStats.NumQueued == 0 || !bIsReady || !IsSocketConnected())
+	{
+		return;
+	}
+
+	for (int32 PriorityIndex = 0; PriorityIndex < static_cast<int32>(ESendPriority::Count) && SendTokens >= 1.0f; ++PriorityIndex)
+	{
+		TArray<FQueuedSend>& Queue = SendQueues[PriorityIndex];
+		while (Queue.Num() > 0 && SendTokens >= 1.0f && Queue[0].NotBefore <= Now)
+		{
+			const int32 SendMessageId = GetNextMessageId();
+			FQueuedSend& Send = InFlightSends.Add(SendMessageId, MoveTemp(Queue[0]));
+			Queue.RemoveAt(0, 1, false);
+			--SendStats.NumQueued;
+			++SendStats.NumInFlight;
+			++Send.NumAttempts;
+			SendTokens -= 1.0f;
+
+			if (Send.Recipient.IsEmpty())
+			{
+				SendMethodMessageArrayParams(MixerStringConstants::MethodNames::Msg, &FMixerChatConnection::HandleSendReply, Send.Body);
+			}
+			else
+			{
+				SendMethodMessageArrayParams(MixerStringConstants::MethodNames::Whisper, &FMixerChatConnection::HandleSendReply, Send.Recipient, Send.Body);
+			}
+		}
+	}
+}
+
+void FMixerChatConnection::RequeueInFlightSends()
+{
+	// Replies to these will never arrive.  Put them back at the front of their queues in their original order.
+	InFlightSends.KeySort(TGreater<int32>());
+	for (TMap<int32, FQueuedSend>::TIterator It(InFlightSends); It; ++It)
+	{
+		SendQueues[static_cast<int32>(It->Value.Priority)].Insert(MoveTemp(It->Value), 0);
+		++SendStats.NumQueued;
+		++SendStats.NumRetried;
+	}
+	SendStats.NumInFlight = 0;
+	InFlightSends.Empty();
+}
+
+bool FMixerChatConnection::HandleSendReply(FJsonObject* JsonObj)
+{
+	GET_JSON_INT_RETURN_FAILURE(Id, ReplyingToMessageId);
+
+	FQueuedSend Send;
+	if (!InFlightSends.RemoveAndCopyValue(ReplyingToMessageId, Send))
+	{
+		return true;
+	}
+	--SendStats.NumInFlight;
 
+	TSharedPtr<FJsonValue> ErrorValue = JsonObj->TryGetField(MixerStringConstants::FieldNames::Error);
+	if (!ErrorValue.IsValid() || ErrorValue->IsNull())
+	{
+		++SendStats.NumSent;
+		return true;
+	}
+
+	FString ErrorMessage;
+	const TSharedPtr<FJsonObject>* ErrorObject;
+	if (ErrorValue->TryGetObject(ErrorObject))
+	{
+		(*ErrorObject)->TryGetStringField(MixerStringConstants::FieldNames::Message, ErrorMessage);
+	}
+	else
+	{
+		ErrorValue->TryGetString(ErrorMessage);
+	}
+
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	if (Send.NumAttempts > Settings->ChatSendMaxRetries)
+	{
+		UE_LOG(LogMixerChat, Warning, TEXT("Dropping chat message to room %s after %d attempts.  Last error: %s"), *RoomId, Send.NumAttempts, *ErrorMessage);
+		++SendStats.NumDropped;
+		return true;
+	}
+
+	// Most likely we're being throttled.  Empty the bucket and back off before trying this one again.
+	UE_LOG(LogMixerChat, Verbose, TEXT("Chat message to room %s rejected (%s).  Will retry."), *RoomId, *ErrorMessage);
+	SendTokens = 0.0f;
+	Send.NotBefore = FPlatformTime::Seconds() + static_cast<double>(1 << FMath::Min(Send.NumAttempts - 1, 4)) / GetChatSendRate(Settings);
+	SendQueues[static_cast<int32>(Send.Priority)].Insert(MoveTemp(Send), 0);
+	++SendStats.NumQueued;
+	++SendStats.NumRetried;
 	return true;
 }
 
@@ -700,12 +1033,31 @@ bool FMixerChatConnection::SendVoteChoose(const FChatPollMixer& Poll, int32 Answ
 
 void FMixerChatConnection::GetMessageHistory(int32 NumMessages, TArray< TSharedRef<FChatMessage> >& OutMessages) const
 {
-	TSharedPtr<FChatMessageMixerImpl> ChatMessage = ChatHistoryNewest;
-	while (ChatMessage.IsValid() &&
-		(NumMessages == -1 || OutMessages.Num() < NumMessages))
+	const int32 MaxToAdd = NumMessages == -1 ? ChatHistorySlotById.Num() : FMath::Min(NumMessages, ChatHistorySlotById.Num());
+	OutMessages.Reserve(OutMessages.Num() + MaxToAdd);
+	int32 NumAdded = 0;
+	for (int32 Age = 0; Age < ChatHistoryNum && NumAdded < MaxToAdd; ++Age)
+	{
+		const TSharedPtr<FChatMessageMixerImpl>& ChatMessage = ChatHistory[ChatHistorySlotFromNewest(Age)];
+		if (ChatMessage.IsValid())
+		{
+			OutMessages.Add(ChatMessage.ToSharedRef());
+			++NumAdded;
+		}
+	}
+}
+
+void FMixerChatConnection::ForEachMessageInHistory(int32 NumMessages, TFunctionRef<void(const FChatMessageMixer&)> Visitor) const
+{
+	int32 NumVisited = 0;
+	for (int32 Age = 0; Age < ChatHistoryNum && (NumMessages == -1 || NumVisited < NumMessages); ++Age)
 	{
-		OutMessages.Add(ChatMessage.ToSharedRef());
-		ChatMessage = ChatMessage->NextLink;
+		const TSharedPtr<FChatMessageMixerImpl>& ChatMessage = ChatHistory[ChatHistorySlotFromNewest(Age)];
+		if (ChatMessage.IsValid())
+		{
+			Visitor(*ChatMessage);
+			++NumVisited;
+		}
 	}
 }
 
@@ -724,67 +1076,65 @@ void FMixerChatConnection::RegisterAllServerMessageHandlers()
 
 void FMixerChatConnection::AddMessageToChatHistory(TSharedRef<FChatMessageMixerImpl> ChatMessage)
 {
-	if (ChatHistoryMax > 0 && !ChatMessage->IsWhisper())
+	if (ChatHistory.Num() > 0 && !ChatMessage->IsWhisper() && !ChatHistorySlotById.Contains(ChatMessage->GetMessageId()))
 	{
-		ChatMessage->NextLink = ChatHistoryNewest;
-		if (ChatHistoryNewest.IsValid())
+		// Evict whatever occupies the slot - either the oldest message or an empty (deleted) slot
+		TSharedPtr<FChatMessageMixerImpl>& Slot = ChatHistory[ChatHistoryNext];
+		if (Slot.IsValid())
 		{
-			ChatHistoryNewest->PrevLink = ChatMessage;
-		}
-		ChatHistoryNewest = ChatMessage;
-		++ChatHistoryNum;
-		if (!ChatHistoryOldest.IsValid())
-		{
-			ChatHistoryOldest = ChatMessage;
-		}
-		else if (ChatHistoryNum > ChatHistoryMax)
-		{
-			ChatHistoryOldest = ChatHistoryOldest->PrevLink;
-			if (ChatHistoryOldest.IsValid())
-			{
-				check(ChatHistoryOldest->NextLink.IsValid());
-				ChatHistoryOldest->NextLink->PrevLink.Reset();
-				ChatHistoryOldest->NextLink.Reset();
-			}
-			--ChatHistoryNum;
+			ChatHistorySlotById.Remove(Slot->GetMessageId());
 		}
+
+		ChatHistorySlotById.Add(ChatMessage->GetMessageId(), ChatHistoryNext);
+		Slot = MoveTemp(ChatMessage);
+		ChatHistoryNext = (ChatHistoryNext + 1) % ChatHistory.Num();
+		ChatHistoryNum = FMath::Min(ChatHistoryNum + 1, ChatHistory.Num());
 	}
 }
 
-void FMixerChatConnection::DeleteFromChatHistoryIf(TFunctionRef<bool(TSharedPtr<FChatMessageMixerImpl>)> Predicate)
+void FMixerChatConnection::DeleteFromChatHistory(const FGuid& MessageId)
 {
 	// @TODO - pass moderator here when available
-	TSharedPtr<FChatMessageMixerImpl> ChatMessage = ChatHistoryNewest;
-	while (ChatMessage.IsValid())
+	int32 Slot;
+	if (ChatHistorySlotById.RemoveAndCopyValue(MessageId, Slot))
 	{
-		TSharedPtr<FChatMessageMixerImpl> NextMessage = ChatMessage->NextLink;
-		if (Predicate(ChatMessage))
+		ChatHistory[Slot]->FlagAsDeleted();
+		ChatHistory[Slot].Reset();
+	}
+}
+
+void FMixerChatConnection::DeleteFromChatHistoryIf(TFunctionRef<bool(const FChatMessageMixerImpl&)> Predicate)
+{
+	// @TODO - pass moderator here when available
+	for (int32 Age = 0; Age < ChatHistoryNum; ++Age)
+	{
+		TSharedPtr<FChatMessageMixerImpl>& ChatMessage = ChatHistory[ChatHistorySlotFromNewest(Age)];
+		if (ChatMessage.IsValid() && Predicate(*ChatMessage))
 		{
+			ChatHistorySlotById.Remove(ChatMessage->GetMessageId());
 			ChatMessage->FlagAsDeleted();
-			if (ChatMessage == ChatHistoryNewest)
-			{
-				ChatHistoryNewest = ChatMessage->NextLink;
-			}
-			if (ChatMessage == ChatHistoryOldest)
-			{
-				ChatHistoryOldest = ChatMessage->PrevLink;
-			}
-			if (ChatMessage->NextLink.IsValid())
-			{
-				ChatMessage->NextLink->PrevLink = ChatMessage->PrevLink;
-			}
-			if (ChatMessage->PrevLink.IsValid())
-			{
-				ChatMessage->PrevLink->NextLink = ChatMessage->NextLink;
-			}
-			ChatMessage->NextLink.Reset();
-			ChatMessage->PrevLink.Reset();
-			--ChatHistoryNum;
+			ChatMessage.Reset();
 		}
-		ChatMessage = NextMessage;
 	}
 }
 
+void FMixerChatConnection::ResetChatHistory()
+{
+	for (TSharedPtr<FChatMessageMixerImpl>& ChatMessage : ChatHistory)
+	{
+		ChatMessage.Reset();
+	}
+	ChatHistorySlotById.Reset();
+	ChatHistoryNext = 0;
+	ChatHistoryNum = 0;
+}
+
+int32 FMixerChatConnection::ChatHistorySlotFromNewest(int32 Age) const
+{
+	check(Age < ChatHistoryNum);
+	const int32 Slot = ChatHistoryNext - 1 - Age;
+	return Slot >= 0 ? Slot : Slot + ChatHistory.Num();
+}
 
 bool FMixerChatConnection::HandleAuthReply(FJsonObject* JsonObj)
 {
@@ -793,6 +1143,17 @@ bool FMixerChatConnection::HandleAuthReply(FJsonObject* JsonObj)
 	{
 		FString ErrorMessage;
 		(*Error)->TryGetStringField(MixerStringConstants::FieldNames::Message, ErrorMessage);
+
+		if (bUsingCachedServerInfo)
+		{
+			// The cached authkey has probably expired.  Fetch a fresh one and try again.
+			UE_LOG(LogMixerChat, Log, TEXT("Cached chat credentials for room %s were rejected (%s).  Refreshing."), *RoomId, *ErrorMessage);
+			CleanupConnection();
+			ChatInterface->GetDiscoveryCache()->InvalidateChatServers(ChannelId);
+			JoinDiscoveredChatChannel();
+			return true;
+		}
+
 		ChatInterface->ConnectAttemptFinished(*User, RoomId, false, ErrorMessage);
 
 		// Note: we have probably self-destructed at this point
@@ -801,9 +1162,9 @@ bool FMixerChatConnection::HandleAuthReply(FJsonObject* JsonObj)
 	else
 	{
 		bIsReady = true;
-		if (ChatHistoryMax > 0)
+		if (ChatHistory.Num() > 0)
 		{
-			SendMethodMessageArrayParams(MixerStringConstants::MethodNames::History, &FMixerChatConnection::HandleHistoryReply, FMath::Min(ChatHistoryMax, 100));
+			SendMethodMessageArrayParams(MixerStringConstants::MethodNames::History, &FMixerChatConnection::HandleHistoryReply, FMath::Min(ChatHistory.Num(), MaxHistoryRequestSize));
 		}
 		// Maybe we have some interest in roles?
 
@@ -817,88 +1178,147 @@ bool FMixerChatConnection::HandleHistoryReply(FJsonObject* JsonObj)
 {
 	GET_JSON_ARRAY_RETURN_FAILURE(Data, Data);
 
-	// Stash the current history and then clear member pointers.
-	// We'll splice what we have back on the front of the history
-	// reported by the server.
-	TSharedPtr<FChatMessageMixerImpl> LocalHistoryNewest = ChatHistoryNewest;
-	TSharedPtr<FChatMessageMixerImpl> LocalHistoryOldest = ChatHistoryOldest;
-	int32 LocalHistoryNum = ChatHistoryNum;
-	int32 LocalHistoryMax = ChatHistoryMax;
-	ChatHistoryNewest.Reset();
-	ChatHistoryOldest.Reset();
-	ChatHistoryNum = 0;
-	ChatHistoryMax = LocalHistoryMax - LocalHistoryNum;
-
-	// Oldest entry is at index 0 as reported by Mixer
-	// Whereas we keep the newest entry at the head of the list,
-	// which is where HandleChatMessagePacket pushes.
-	for (const TSharedPtr<FJsonValue> HistoryEntry : *Data)
+	// Messages already held (oldest first), whether from live chat that arrived while the
+	// request was in flight or from an earlier page.  These are reused, never rebuilt.
+	TArray<TSharedPtr<FChatMessageMixerImpl>> LocalMessages;
+	TMap<FGuid, int32> LocalIndexById;
+	LocalMessages.Reserve(ChatHistorySlotById.Num());
+	LocalIndexById.Reserve(ChatHistorySlotById.Num());
+	for (int32 Age = ChatHistoryNum - 1; Age >= 0; --Age)
 	{
-		TSharedPtr<FChatMessageMixerImpl> ChatMessage;
-		if (HandleChatMessageEventInternal(HistoryEntry->AsObject().Get(), ChatMessage))
+		const TSharedPtr<FChatMessageMixerImpl>& ChatMessage = ChatHistory[ChatHistorySlotFromNewest(Age)];
+		if (ChatMessage.IsValid())
 		{
-			check(!ChatMessage->IsWhisper());
-			AddMessageToChatHistory(ChatMessage.ToSharedRef());
+			LocalIndexById.Add(ChatMessage->GetMessageId(), LocalMessages.Add(ChatMessage));
 		}
 	}
 
-	// Relink the history we'd already accumulated.
-	// Possibly our history request crossed paths with some
-	// new messages and we could have some dupes?
-	if (!ChatHistoryNewest.IsValid())
+	// Single ordered merge.  Mixer reports the oldest entry first.  When a server entry is one
+	// we already hold, everything we hold up to and including it goes first, so local ordering
+	// is kept and nothing appears twice.
+	TArray<TSharedPtr<FChatMessageMixerImpl>> Merged;
+	Merged.Reserve(Data->Num() + LocalMessages.Num());
+	int32 NextLocal = 0;
+	for (const TSharedPtr<FJsonValue>& HistoryEntry : *Data)
 	{
-		ChatHistoryNewest = LocalHistoryNewest;
-		ChatHistoryOldest = LocalHistoryOldest;
-	}
-	else if (LocalHistoryOldest.IsValid())
-	{
-		int32 DupeCount = 0;
-		FGuid IdToCheckForDupes = LocalHistoryOldest->GetMessageId();
-		TSharedPtr<FChatMessageMixerImpl> ServerHistoryMessage = ChatHistoryNewest;
-		while (ServerHistoryMessage.IsValid())
+		const TSharedPtr<FJsonObject>* EntryObj;
+		FString IdString;
+		FGuid MessageId;
+		if (!HistoryEntry->TryGetObject(EntryObj) ||
+			!(*EntryObj)->TryGetStringField(MixerStringConstants::FieldNames::Id, IdString) ||
+			!FGuid::Parse(IdString, MessageId))
+		{
+			UE_LOG(LogMixerChat, Warning, TEXT("Skipping malformed chat history entry for room %s"), *RoomId);
+			continue;
+		}
+
+		const int32* LocalIndex = LocalIndexById.Find(MessageId);
+		if (LocalIndex != nullptr)
 		{
-			++DupeCount;
-			if (ServerHistoryMessage->GetMessageId() == IdToCheckForDupes)
+			for (; NextLocal <= *LocalIndex; ++NextLocal)
 			{
-				break;
+				Merged.Add(LocalMessages[NextLocal]);
 			}
-			ServerHistoryMessage = ServerHistoryMessage->NextLink;
+			continue;
 		}
 
-		if (ServerHistoryMessage.IsValid())
+		FMixerParsedChatMessage ParsedMessage;
+		if (MixerChatIngest::ParseChatMessage(EntryObj->Get(), ParsedMessage))
 		{
-			LocalHistoryOldest->NextLink = ServerHistoryMessage->NextLink;
-			if (ServerHistoryMessage->NextLink.IsValid())
+			if (ModerationFilter.IsValid())
+			{
+				ParsedMessage.bIsFiltered = ModerationFilter->Apply(ParsedMessage.Content);
+			}
+
+			// Votes the active vote kept out of chat when they arrived shouldn't reappear from history.
+			// They were counted when they arrived, so here they are only matched, never tallied.
+			if (ActiveChatVote.IsValid() && ActiveChatVote->ConsumesVoteMessages() && !ParsedMessage.bIsWhisper && !ParsedMessage.bIsFiltered &&
+				ParsedMessage.Content.Num() > 0 && ActiveChatVote->IsVote(ParsedMessage.Content.GetFragment(0)))
 			{
-				ServerHistoryMessage->NextLink->PrevLink = LocalHistoryOldest;
+				continue;
+			}
+
+			TSharedPtr<FChatMessageMixerImpl> ChatMessage = BuildChatMessage(ParsedMessage);
+			if (ChatMessage.IsValid() && !ChatMessage->IsWhisper())
+			{
+				Merged.Add(ChatMessage);
 			}
-			ChatHistoryNum -= DupeCount;
 		}
-		else
+	}
+
+	for (; NextLocal < LocalMessages.Num(); ++NextLocal)
+	{
+		Merged.Add(LocalMessages[NextLocal]);
+	}
+
+	// Refill the ring.  If the merge produced more than fits, the oldest fall away.
+	ResetChatHistory();
+	for (const TSharedPtr<FChatMessageMixerImpl>& ChatMessage : Merged)
+	{
+		AddMessageToChatHistory(ChatMessage.ToSharedRef());
+	}
+
+	ChatInterface->TriggerOnChatRoomHistoryLoadedDelegates(*User, RoomId);
+
+	return true;
+}
+
+bool FMixerChatConnection::RequestOlderHistory(int32 NumMessages)
+{
+	if (!bIsReady || NumMessages <= 0)
+	{
+		return false;
+	}
+
+	// The service only returns the most recent messages, so paging back means asking for more of
+	// them and merging.  That needs room in the ring for the extra, older messages.
+	const int32 NewCapacity = FMath::Min(ChatHistory.Num() + NumMessages, MaxHistoryRequestSize);
+	if (NewCapacity <= ChatHistory.Num())
+	{
+		UE_LOG(LogMixerChat, Warning, TEXT("Chat history for room %s already holds as many messages as the service can return."), *RoomId);
+		return false;
+	}
+
+	TArray<TSharedPtr<FChatMessageMixerImpl>> Existing;
+	Existing.Reserve(ChatHistoryNum);
+	for (int32 Age = ChatHistoryNum - 1; Age >= 0; --Age)
+	{
+		const TSharedPtr<FChatMessageMixerImpl>& ChatMessage = ChatHistory[ChatHistorySlotFromNewest(Age)];
+		if (ChatMessage.IsValid())
 		{
-			LocalHistoryOldest->NextLink = ChatHistoryNewest;
-			ChatHistoryNewest->PrevLink = LocalHistoryOldest;
+			Existing.Add(ChatMessage);
 		}
+	}
 
-		ChatHistoryNewest = LocalHistoryNewest;
-		ChatHistoryNum += LocalHistoryNum;
-		ChatHistoryMax = LocalHistoryMax;
+	ResetChatHistory();
+	ChatHistory.SetNum(NewCapacity);
+	ChatHistorySlotById.Reserve(NewCapacity);
+	for (const TSharedPtr<FChatMessageMixerImpl>& ChatMessage : Existing)
+	{
+		AddMessageToChatHistory(ChatMessage.ToSharedRef());
 	}
 
+	SendMethodMessageArrayParams(MixerStringConstants::MethodNames::History, &FMixerChatConnection::HandleHistoryReply, NewCapacity);
 	return true;
 }
 
 void FMixerChatConnection::GetAllCachedUsers(TArray< TSharedRef<FChatRoomMember> >& OutUsers) const
 {
-	for (TMap<FUniqueNetIdMixer, TSharedPtr<FMixerChatUser>>::TConstIterator It(CachedUsers); It; ++It)
-	{
-		OutUsers.Add(It->Value.ToSharedRef());
-	}
+	CachedUsers.GetAll(OutUsers);
+}
+
+void FMixerChatConnection::GetUserCacheStats(FMixerChatUserCacheStats& OutStats) const
+{
+	CachedUsers.GetStats(OutStats);
+}
+
+void FMixerChatConnection::GetSendQueueStats(FMixerChatSendQueueStats& OutStats) const
+{
+	OutStats = SendStats;
 }
 
 TSharedPtr<FMixerChatUser> FMixerChatConnection::FindUser(const FUniqueNetId& UserId) const
 {
-	const TSharedPtr<FMixerChatUser>* FoundUser = CachedUsers.Find(FUniqueNetIdMixer(UserId));
-	return FoundUser != nullptr ? *FoundUser : nullptr;
+	return CachedUsers.FindNoTouch(FUniqueNetIdMixer(UserId));
 }
 
@@ -15,12 +15,17 @@
 #include "Interfaces/IHttpResponse.h"
 #include "OnlineChatMixerPrivate.h"
 #include "MixerWebSocketOwnerBase.h"
+#include "MixerChatIngest.h"
+#include "MixerChatUserCache.h"
+#include "MixerChatDiscovery.h"
+#include "Containers/Ticker.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogMixerChat, Log, All);
 
 class FMixerChatConnection
 	: public TMixerWebSocketOwnerBase<FMixerChatConnection>
 	, public TSharedFromThis<FMixerChatConnection>
+	, public FTickerObjectBase
 {
 public:
 	FMixerChatConnection(class FOnlineChatMixer* InChatInterface, const FUniqueNetId& UserId, const FChatRoomId& InRoomId, const FChatRoomConfig& Config);
@@ -30,20 +35,34 @@ public:
 
 	bool SendChatMessage(const FString& MessageBody);
 	bool SendWhisper(const FString& ToUser, const FString& MessageBody);
+	bool SendAnnouncement(FName Key, const FString& MessageBody);
 	bool SendVoteStart(const FString& Question, const TArray<FString>& Answers, FTimespan Duration);
 	bool SendVoteChoose(const FChatPollMixer& Poll, int32 AnswerIndex);
 
+	void StartChatVote(const TArray<FString>& Options, bool bConsumeVoteMessages);
+	bool StopChatVote();
+	bool GetChatVoteTally(TArray<int32>& OutVotes) const;
+
+	void SetModerationFilter(const TSharedPtr<const FMixerChatModerationFilter, ESPMode::ThreadSafe>& Filter);
+
 	const FChatRoomId& GetRoom() const			{ return RoomId; }
 	bool IsAnonymous() const					{ return AuthKey.IsEmpty(); }
 
 	void SetRejoinOnDisconnect(bool bInRejoin)	{ bRejoinOnDisconnect = bInRejoin; }
 
 	void GetMessageHistory(int32 NumMessages, TArray<TSharedRef<FChatMessage>>& OutMessages) const;
+	void ForEachMessageInHistory(int32 NumMessages, TFunctionRef<void(const FChatMessageMixer&)> Visitor) const;
+	bool RequestOlderHistory(int32 NumMessages);
 
 	void GetAllCachedUsers(TArray< TSharedRef<FChatRoomMember> >& OutUsers) const;
+	void GetUserCacheStats(FMixerChatUserCacheStats& OutStats) const;
+	void GetSendQueueStats(FMixerChatSendQueueStats& OutStats) const;
 
 	TSharedPtr<FMixerChatUser> FindUser(const FUniqueNetId& UserId) const;
 
+public:
+	virtual bool Tick(float DeltaTime) override;
+
 protected:
 	virtual void RegisterAllServerMessageHandlers();
 	virtual bool OnUnhandledServerMessage(const FString& MessageType, const TSharedPtr<FJsonObject> Params) { return false; }
@@ -52,12 +71,14 @@ protected:
 	virtual void HandleSocketConnectionError();
 	virtual void HandleSocketClosed(bool bWasClean);
 
+	virtual bool DeferSocketMessage(const FString& MessageJsonString) override;
+
 private:
 
 	void JoinDiscoveredChatChannel();
 
-	void OnGetChannelInfoForRoomIdComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
-	void OnDiscoverChatServersComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
+	void OnChannelIdResolved(int32 InChannelId);
+	void OnChatServersResolved(TSharedPtr<const FMixerChatServerInfo> ServerInfo, bool bFromCache);
 
 	bool HandleWelcomeEvent(class FJsonObject* JsonObj);
 	bool HandleChatMessageEvent(class FJsonObject* JsonObj);
@@ -69,17 +90,44 @@ private:
 	bool HandlePollStartEvent(class FJsonObject* JsonObj);
 	bool HandlePollEndEvent(class FJsonObject* JsonObj);
 
-	bool HandleChatMessageEventInternal(class FJsonObject* JsonObj, TSharedPtr<FChatMessageMixerImpl>& OutMessage);
-	bool HandleChatMessageEventMessageObject(class FJsonObject* JsonObj, FChatMessageMixerImpl* ChatMessage);
-	bool HandleChatMessageEventMessageArrayEntry(class FJsonObject* JsonObj, FChatMessageMixerImpl* ChatMessage);
+	TSharedPtr<FChatMessageMixerImpl> BuildChatMessage(FMixerParsedChatMessage& ParsedMessage);
+	void DeliverChatMessage(TSharedRef<FChatMessageMixerImpl> ChatMessage);
+	void DeliverIngestedMessages();
+
+	// Outgoing chat, in descending priority order
+	enum class ESendPriority : uint8
+	{
+		Whisper,
+		Chat,
+		Announcement,
+		Count
+	};
+
+	struct FQueuedSend
+	{
+		ESendPriority Priority;
+		FString Recipient;
+		FString Body;
+		FName CoalesceKey;
+		int32 NumAttempts;
+		double NotBefore;
+	};
+
+	void EnqueueSend(ESendPriority Priority, const FString& Recipient, const FString& Body, FName CoalesceKey);
+	void PumpSendQueue();
+	void RequeueInFlightSends();
 	bool HandlePollEndEventInternal(class FJsonObject* JsonObj);
 	bool UpdateActivePollFromServer(class FJsonObject* JsonObj, bool& bOutAnythingChanged);
 
 	void AddMessageToChatHistory(TSharedRef<struct FChatMessageMixerImpl> ChatMessage);
-	void DeleteFromChatHistoryIf(TFunctionRef<bool(TSharedPtr<FChatMessageMixerImpl>)> Predicate);
+	void DeleteFromChatHistory(const FGuid& MessageId);
+	void DeleteFromChatHistoryIf(TFunctionRef<bool(const FChatMessageMixerImpl&)> Predicate);
+	void ResetChatHistory();
+	int32 ChatHistorySlotFromNewest(int32 Age) const;
 
 private:
 	bool HandleAuthReply(class FJsonObject* JsonObj);
+	bool HandleSendReply(class FJsonObject* JsonObj);
 	bool HandleHistoryReply(class FJsonObject* JsonObj);
 
 private:
@@ -88,13 +136,38 @@ private:
 	FChatRoomId RoomId;
 	FString AuthKey;
 	TArray<FString> Endpoints;
-	TMap<FUniqueNetIdMixer, TSharedPtr<FMixerChatUser>> CachedUsers;
+	FMixerChatUserCache CachedUsers;
 	TSharedPtr<struct FChatPollMixerImpl> ActivePoll;
-	TSharedPtr<struct FChatMessageMixerImpl> ChatHistoryNewest;
-	TSharedPtr<struct FChatMessageMixerImpl> ChatHistoryOldest;
+
+	// Fixed capacity ring of recent room messages.  Slots of deleted messages are
+	// left empty until overwritten, so removal by id never has to shift entries.
+	TArray<TSharedPtr<struct FChatMessageMixerImpl>> ChatHistory;
+	TMap<FGuid, int32> ChatHistorySlotById;
+	int32 ChatHistoryNext;
 	int32 ChatHistoryNum;
-	int32 ChatHistoryMax;
 	int32 ChannelId;
+
+	// Null if chat is parsed on the game thread.  An item that was dequeued but held back
+	// by the per-frame budget waits in HeldIngestItem so that ordering is preserved.
+	TSharedPtr<FMixerChatIngestPipeline, ESPMode::ThreadSafe> IngestPipeline;
+	FMixerChatIngestItem HeldIngestItem;
+	bool bHasHeldIngestItem;
+
+	// Set when connecting with endpoints and authkey reused from the discovery cache,
+	// in which case an auth failure triggers a fresh discovery rather than giving up.
+	bool bUsingCachedServerInfo;
+
+	TSharedPtr<FMixerChatVote, ESPMode::ThreadSafe> ActiveChatVote;
+	TSharedPtr<const FMixerChatModerationFilter, ESPMode::ThreadSafe> ModerationFilter;
+
+	// Token bucket limiting outgoing chat.  Sends wait in per-priority FIFOs until a
+	// token is available; sent messages are tracked by message id until the server replies.
+	TArray<FQueuedSend> SendQueues[static_cast<int32>(ESendPriority::Count)];
+	TMap<int32, FQueuedSend> InFlightSends;
+	float SendTokens;
+	double LastSendTokenRefillTime;
+	FMixerChatSendQueueStats SendStats;
+
 	bool bIsReady;
 	bool bRejoinOnDisconnect;
 
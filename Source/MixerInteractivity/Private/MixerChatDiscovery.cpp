@@ -0,0 +1,213 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerChatDiscovery.h"
+#include "MixerInteractivitySettings.h"
+#include "MixerJsonHelpers.h"
+
+#include "HttpModule.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+void FMixerChatDiscoveryCache::SeedChannelId(const FString& ChannelName, int32 ChannelId)
+{
+	FChannelIdEntry& Entry = ChannelIds.FindOrAdd(ChannelName);
+	if (Entry.Waiters.Num() == 0)
+	{
+		Entry.ChannelId = ChannelId;
+		Entry.ExpiresAt = FPlatformTime::Seconds() + GetDefault<UMixerInteractivitySettings>()->ChatChannelIdCacheSeconds;
+	}
+}
+
+bool FMixerChatDiscoveryCache::ResolveChannelId(const FString& ChannelName, const FOnMixerChannelIdResolved& OnComplete)
+{
+	FChannelIdEntry* Entry = ChannelIds.Find(ChannelName);
+	if (Entry != nullptr)
+	{
+		if (Entry->Waiters.Num() > 0)
+		{
+			// Piggyback on the request already in flight
+			Entry->Waiters.Add(OnComplete);
+			return true;
+		}
+
+		if (Entry->ChannelId != 0 && Entry->ExpiresAt > FPlatformTime::Seconds())
+		{
+			OnComplete.ExecuteIfBound(Entry->ChannelId);
+			return true;
+		}
+	}
+
+	TSharedRef<IHttpRequest> ChannelRequest = FHttpModule::Get().CreateRequest();
+	ChannelRequest->SetVerb(TEXT("GET"));
+	ChannelRequest->SetURL(FString::Printf(TEXT("https://mixer.com/api/v1/channels/%s"), *ChannelName));
+	ChannelRequest->OnProcessRequestComplete().BindSP(this, &FMixerChatDiscoveryCache::OnChannelRequestComplete, ChannelName);
+	if (!ChannelRequest->ProcessRequest())
+	{
+		return false;
+	}
+
+	FChannelIdEntry& NewEntry = ChannelIds.FindOrAdd(ChannelName);
+	NewEntry.ChannelId = 0;
+	NewEntry.ExpiresAt = 0.0;
+	NewEntry.Waiters.Add(OnComplete);
+	return true;
+}
+
+bool FMixerChatDiscoveryCache::ResolveChatServers(int32 ChannelId, const FString& AuthZHeaderValue, const FOnMixerChatServersResolved& OnComplete)
+{
+	FChatServersEntry* Entry = ChatServers.Find(ChannelId);
+	if (Entry != nullptr && Entry->AuthZHeaderValue == AuthZHeaderValue)
+	{
+		if (Entry->Waiters.Num() > 0)
+		{
+			Entry->Waiters.Add(OnComplete);
+			return true;
+		}
+
+		if (Entry->Info.IsValid() && Entry->ExpiresAt > FPlatformTime::Seconds())
+		{
+			OnComplete.ExecuteIfBound(Entry->Info, true);
+			return true;
+		}
+	}
+
+	TSharedRef<IHttpRequest> ChatRequest = FHttpModule::Get().CreateRequest();
+	ChatRequest->SetVerb(TEXT("GET"));
+	ChatRequest->SetURL(FString::Printf(TEXT("https://mixer.com/api/v1/chats/%d?fields=id"), ChannelId));
+
+	// Setting Authorization header to an empty string will just fail rather than perform anonymous auth.
+	if (AuthZHeaderValue.Len() > 0)
+	{
+		ChatRequest->SetHeader(TEXT("Authorization"), AuthZHeaderValue);
+	}
+
+	ChatRequest->OnProcessRequestComplete().BindSP(this, &FMixerChatDiscoveryCache::OnChatServersRequestComplete, ChannelId);
+	if (!ChatRequest->ProcessRequest())
+	{
+		return false;
+	}
+
+	// A request for different authorization supersedes any in flight; its waiters get the newer result.
+	FChatServersEntry& NewEntry = ChatServers.FindOrAdd(ChannelId);
+	NewEntry.Info.Reset();
+	NewEntry.AuthZHeaderValue = AuthZHeaderValue;
+	NewEntry.ExpiresAt = 0.0;
+	NewEntry.Waiters.Add(OnComplete);
+	return true;
+}
+
+void FMixerChatDiscoveryCache::InvalidateChatServers(int32 ChannelId)
+{
+	FChatServersEntry* Entry = ChatServers.Find(ChannelId);
+	if (Entry != nullptr && Entry->Waiters.Num() == 0)
+	{
+		ChatServers.Remove(ChannelId);
+	}
+}
+
+void FMixerChatDiscoveryCache::OnChannelRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FString ChannelName)
+{
+	int32 ChannelId = 0;
+	if (bSucceeded && HttpResponse.IsValid())
+	{
+		if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
+		{
+			FString ResponseStr = HttpResponse->GetContentAsString();
+			TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
+			TSharedPtr<FJsonObject> JsonObject;
+			if (FJsonSerializer::Deserialize(JsonReader, JsonObject) &&
+				JsonObject.IsValid())
+			{
+				JsonObject->TryGetNumberField(MixerStringConstants::FieldNames::Id, ChannelId);
+			}
+		}
+	}
+
+	TArray<FOnMixerChannelIdResolved> Waiters;
+	FChannelIdEntry* Entry = ChannelIds.Find(ChannelName);
+	if (Entry != nullptr)
+	{
+		Waiters = MoveTemp(Entry->Waiters);
+		Entry->Waiters.Reset();
+		if (ChannelId != 0)
+		{
+			Entry->ChannelId = ChannelId;
+			Entry->ExpiresAt = FPlatformTime::Seconds() + GetDefault<UMixerInteractivitySettings>()->ChatChannelIdCacheSeconds;
+		}
+		else
+		{
+			// Don't cache failure
+			ChannelIds.Remove(ChannelName);
+		}
+	}
+
+	// Waiters may issue further requests, so only call them once the cache is consistent
+	for (const FOnMixerChannelIdResolved& Waiter : Waiters)
+	{
+		Waiter.ExecuteIfBound(ChannelId);
+	}
+}
+
+void FMixerChatDiscoveryCache::OnChatServersRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, int32 ChannelId)
+{
+	FChatServersEntry* Entry = ChatServers.Find(ChannelId);
+	if (Entry == nullptr || Entry->Waiters.Num() == 0)
+	{
+		return;
+	}
+
+	if (HttpRequest.IsValid() && Entry->AuthZHeaderValue != HttpRequest->GetHeader(TEXT("Authorization")))
+	{
+		// Superseded by a request with different authorization, which will complete the waiters
+		return;
+	}
+
+	TSharedPtr<FMixerChatServerInfo> Info;
+	if (bSucceeded && HttpResponse.IsValid())
+	{
+		if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
+		{
+			FString ResponseStr = HttpResponse->GetContentAsString();
+			TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(ResponseStr);
+			TSharedPtr<FJsonObject> JsonObject;
+			const TArray<TSharedPtr<FJsonValue>>* JsonEndpoints;
+			if (FJsonSerializer::Deserialize(JsonReader, JsonObject) &&
+				JsonObject.IsValid() &&
+				JsonObject->TryGetArrayField(MixerStringConstants::FieldNames::Endpoints, JsonEndpoints))
+			{
+				Info = MakeShared<FMixerChatServerInfo>();
+				for (const TSharedPtr<FJsonValue>& Endpoint : *JsonEndpoints)
+				{
+					Info->Endpoints.Add(Endpoint->AsString());
+				}
+
+				JsonObject->TryGetStringField(MixerStringConstants::FieldNames::AuthKey, Info->AuthKey);
+				JsonObject->TryGetStringArrayField(MixerStringConstants::FieldNames::Permissions, Info->Permissions);
+			}
+		}
+	}
+
+	TArray<FOnMixerChatServersResolved> Waiters = MoveTemp(Entry->Waiters);
+	Entry->Waiters.Reset();
+	if (Info.IsValid() && Info->Endpoints.Num() > 0)
+	{
+		Entry->Info = Info;
+		Entry->ExpiresAt = FPlatformTime::Seconds() + GetDefault<UMixerInteractivitySettings>()->ChatServerCacheSeconds;
+	}
+	else
+	{
+		ChatServers.Remove(ChannelId);
+	}
+
+	for (const FOnMixerChatServersResolved& Waiter : Waiters)
+	{
+		Waiter.ExecuteIfBound(Info, false);
+	}
+}
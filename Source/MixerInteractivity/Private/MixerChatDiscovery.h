@@ -0,0 +1,86 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+
+/** Result of asking the Mixer service how to connect to a channel's chat */
+struct FMixerChatServerInfo
+{
+	TArray<FString> Endpoints;
+	FString AuthKey;
+	TArray<FString> Permissions;
+};
+
+/** @param ChannelId	id of the channel, or 0 if it could not be resolved */
+DECLARE_DELEGATE_OneParam(FOnMixerChannelIdResolved, int32 /*ChannelId*/);
+
+/**
+* @param ServerInfo	connection info, or null if it could not be retrieved
+* @param bFromCache	whether the info was cached from an earlier request rather than freshly retrieved
+*/
+DECLARE_DELEGATE_TwoParams(FOnMixerChatServersResolved, TSharedPtr<const FMixerChatServerInfo> /*ServerInfo*/, bool /*bFromCache*/);
+
+/**
+* Chat discovery results shared between all chat connections.  Channel ids practically never
+* change so are kept for a long time; endpoints and authkeys are kept briefly so that rejoining
+* or upgrading a room connection can skip straight to opening the socket.
+* Concurrent requests for the same channel share a single HTTP request.
+*/
+class FMixerChatDiscoveryCache : public TSharedFromThis<FMixerChatDiscoveryCache>
+{
+public:
+	/** Record a channel id that is already known, e.g. that of the logged in user */
+	void SeedChannelId(const FString& ChannelName, int32 ChannelId);
+
+	/**
+	* Look up the id of a channel by name.  Completes immediately if cached.
+	*
+	* @Return	false if the request could not be started, in which case OnComplete will not be called.
+	*/
+	bool ResolveChannelId(const FString& ChannelName, const FOnMixerChannelIdResolved& OnComplete);
+
+	/**
+	* Get the chat endpoints, authkey and permissions for a channel.  Completes immediately if cached
+	* for the same authorization.
+	*
+	* @Return	false if the request could not be started, in which case OnComplete will not be called.
+	*/
+	bool ResolveChatServers(int32 ChannelId, const FString& AuthZHeaderValue, const FOnMixerChatServersResolved& OnComplete);
+
+	/** Forget cached connection info for a channel, e.g. because the server rejected its authkey */
+	void InvalidateChatServers(int32 ChannelId);
+
+private:
+	struct FChannelIdEntry
+	{
+		int32 ChannelId;
+		double ExpiresAt;
+		TArray<FOnMixerChannelIdResolved> Waiters;
+	};
+
+	struct FChatServersEntry
+	{
+		TSharedPtr<const FMixerChatServerInfo> Info;
+		FString AuthZHeaderValue;
+		double ExpiresAt;
+		TArray<FOnMixerChatServersResolved> Waiters;
+	};
+
+	void OnChannelRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, FString ChannelName);
+	void OnChatServersRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded, int32 ChannelId);
+
+private:
+	// Entries with waiters have a request in flight
+	TMap<FString, FChannelIdEntry> ChannelIds;
+	TMap<int32, FChatServersEntry> ChatServers;
+};
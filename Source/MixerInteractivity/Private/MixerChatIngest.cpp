@@ -0,0 +1,206 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerChatIngest.h"
+#include "MixerChatConnection.h"
+#include "MixerJsonHelpers.h"
+
+#include "Async/Async.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+void FMixerChatIngestPipeline::Enqueue(const FString& RawMessage)
+{
+	RawMessages.Enqueue(RawMessage);
+	if (NumUnparsedMessages.Increment() == 1)
+	{
+		TSharedRef<FMixerChatIngestPipeline, ESPMode::ThreadSafe> Pipeline = AsShared();
+		Async<void>(EAsyncExecution::ThreadPool, [Pipeline]()
+		{
+			Pipeline->ParseQueuedMessages();
+		});
+	}
+}
+
+bool FMixerChatIngestPipeline::Dequeue(FMixerChatIngestItem& OutItem)
+{
+	if (!ParsedMessages.Dequeue(OutItem))
+	{
+		return false;
+	}
+
+	if (OutItem.bIsChatMessage)
+	{
+		NumQueuedChatMessages.Decrement();
+	}
+	return true;
+}
+
+void FMixerChatIngestPipeline::SetActiveVote(const TSharedPtr<FMixerChatVote, ESPMode::ThreadSafe>& Vote)
+{
+	FScopeLock Lock(&ActiveVoteLock);
+	ActiveVote = Vote;
+}
+
+void FMixerChatIngestPipeline::SetModerationFilter(const TSharedPtr<const FMixerChatModerationFilter, ESPMode::ThreadSafe>& Filter)
+{
+	FScopeLock Lock(&ModerationFilterLock);
+	ModerationFilter = Filter;
+}
+
+void FMixerChatIngestPipeline::ParseQueuedMessages()
+{
+	do
+	{
+		FString RawMessage;
+		verify(RawMessages.Dequeue(RawMessage));
+		ParseSingleMessage(RawMessage);
+	} while (NumUnparsedMessages.Decrement() > 0);
+}
+
+void FMixerChatIngestPipeline::ParseSingleMessage(const FString& RawMessage)
+{
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(RawMessage);
+	TSharedPtr<FJsonObject> JsonObj;
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObj) || !JsonObj.IsValid())
+	{
+		UE_LOG(LogMixerChat, Warning, TEXT("Failed to parse websocket message from server: %s"), *RawMessage);
+		return;
+	}
+
+	FMixerChatIngestItem Item;
+	FString MessageType;
+	FString EventType;
+	const TSharedPtr<FJsonObject>* Data;
+	if (JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Type, MessageType) && MessageType == MixerStringConstants::MessageTypes::Event &&
+		JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Event, EventType) && EventType == MixerStringConstants::EventTypes::ChatMessage &&
+		JsonObj->TryGetObjectField(MixerStringConstants::FieldNames::Data, Data) &&
+		MixerChatIngest::ParseChatMessage(Data->Get(), Item.ChatMessage))
+	{
+		TSharedPtr<const FMixerChatModerationFilter, ESPMode::ThreadSafe> Filter;
+		{
+			FScopeLock Lock(&ModerationFilterLock);
+			Filter = ModerationFilter;
+		}
+
+		if (Filter.IsValid())
+		{
+			Item.ChatMessage.bIsFiltered = Filter->Apply(Item.ChatMessage.Content);
+		}
+
+		// Moderation runs first so that blocked messages never count as votes
+		if (!Item.ChatMessage.bIsWhisper && !Item.ChatMessage.bIsFiltered && Item.ChatMessage.Content.Num() > 0)
+		{
+			// Count under the lock so that SetActiveVote can't return while a count is in progress.
+			// A vote handed on to another pipeline (or back to the game thread) then has one writer.
+			bool bConsumed;
+			{
+				FScopeLock Lock(&ActiveVoteLock);
+				bConsumed = ActiveVote.IsValid() && ActiveVote->CountVote(Item.ChatMessage.UserId, Item.ChatMessage.Content.GetFragment(0)) && ActiveVote->ConsumesVoteMessages();
+			}
+
+			if (bConsumed)
+			{
+				// Only the tally is of interest - the game thread never sees this message
+				return;
+			}
+		}
+
+		Item.bIsChatMessage = true;
+		NumQueuedChatMessages.Increment();
+	}
+	else
+	{
+		// Malformed chat messages take this path too, so they are reported by the regular handler
+		Item.Json = JsonObj;
+	}
+
+	ParsedMessages.Enqueue(MoveTemp(Item));
+}
+
+namespace
+{
+	void AddMessageFragment(const FJsonObject* FragmentObj, FMixerChatMessageContent& Content)
+	{
+		FString FragmentType;
+		FString FragmentText;
+		FString FragmentData;
+		int32 TaggedUserId = 0;
+		FragmentObj->TryGetStringField(MixerStringConstants::FieldNames::Type, FragmentType);
+		FragmentObj->TryGetStringField(MixerStringConstants::FieldNames::Text, FragmentText);
+
+		EMixerChatFragmentType Type = EMixerChatFragmentType::Other;
+		if (FragmentType == MixerStringConstants::FragmentTypes::Text)
+		{
+			Type = EMixerChatFragmentType::Text;
+		}
+		else if (FragmentType == MixerStringConstants::FragmentTypes::Emoticon)
+		{
+			Type = EMixerChatFragmentType::Emoticon;
+			FragmentObj->TryGetStringField(MixerStringConstants::FieldNames::Pack, FragmentData);
+		}
+		else if (FragmentType == MixerStringConstants::FragmentTypes::Link)
+		{
+			Type = EMixerChatFragmentType::Link;
+			FragmentObj->TryGetStringField(MixerStringConstants::FieldNames::Url, FragmentData);
+		}
+		else if (FragmentType == MixerStringConstants::FragmentTypes::Tag)
+		{
+			Type = EMixerChatFragmentType::Tag;
+			FragmentObj->TryGetStringField(MixerStringConstants::FieldNames::UserNameNoUnderscore, FragmentData);
+			FragmentObj->TryGetNumberField(MixerStringConstants::FieldNames::Id, TaggedUserId);
+		}
+
+		Content.AddFragment(Type, FragmentText, FragmentData, TaggedUserId);
+	}
+}
+
+bool MixerChatIngest::ParseChatMessage(const FJsonObject* JsonObj, FMixerParsedChatMessage& OutMessage)
+{
+	GET_JSON_INT_RETURN_FAILURE(UserIdWithUnderscore, FromUserIdRaw);
+	GET_JSON_OBJECT_RETURN_FAILURE(Message, MessageJson);
+	GET_JSON_STRING_RETURN_FAILURE(Id, IdString);
+
+	if (!FGuid::Parse(IdString, OutMessage.MessageId))
+	{
+		UE_LOG(LogMixerChat, Error, TEXT("id field %s for chat event was not in the expected format (guid)"), *IdString);
+		return false;
+	}
+
+	OutMessage.UserId = FromUserIdRaw;
+
+	// Only required if the sender isn't already known, which is checked on the game thread
+	JsonObj->TryGetStringField(MixerStringConstants::FieldNames::UserNameWithUnderscore, OutMessage.UserName);
+	OutMessage.bHasUserLevel = JsonObj->TryGetNumberField(MixerStringConstants::FieldNames::UserLevel, OutMessage.UserLevel);
+
+	JsonObj = MessageJson->Get();
+	GET_JSON_ARRAY_RETURN_FAILURE(Message, MessageFragmentArray);
+
+	// Typical fragments are a word or two; overshooting slightly beats regrowing the buffer
+	const int32 ExpectedCharsPerFragment = 32;
+	OutMessage.Content.Reserve(MessageFragmentArray->Num(), MessageFragmentArray->Num() * ExpectedCharsPerFragment);
+	for (const TSharedPtr<FJsonValue>& Fragment : *MessageFragmentArray)
+	{
+		const TSharedPtr<FJsonObject>* FragmentObj;
+		if (Fragment->TryGetObject(FragmentObj))
+		{
+			AddMessageFragment(FragmentObj->Get(), OutMessage.Content);
+		}
+	}
+
+	// These are not required.
+	const TSharedPtr<FJsonObject>* Metadata;
+	if (JsonObj->TryGetObjectField(MixerStringConstants::FieldNames::Meta, Metadata))
+	{
+		(*Metadata)->TryGetBoolField(MixerStringConstants::FieldNames::Whisper, OutMessage.bIsWhisper);
+		(*Metadata)->TryGetBoolField(MixerStringConstants::FieldNames::Me, OutMessage.bIsAction);
+	}
+
+	return true;
+}
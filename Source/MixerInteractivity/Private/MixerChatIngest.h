@@ -0,0 +1,120 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineChatMixerPrivate.h"
+#include "Containers/Queue.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Dom/JsonObject.h"
+#include "Misc/Guid.h"
+#include "Misc/ScopeLock.h"
+#include "MixerChatVote.h"
+#include "MixerChatModerationFilter.h"
+
+/**
+* Fields of a chat message event extracted from the wire format.  Everything except
+* binding the sender to the connection's user cache, which is game thread state.
+*/
+struct FMixerParsedChatMessage
+{
+	FGuid MessageId;
+	int32 UserId;
+	FString UserName;
+	int32 UserLevel;
+	bool bHasUserLevel;
+	FMixerChatMessageContent Content;
+	bool bIsWhisper;
+	bool bIsAction;
+	bool bIsFiltered;
+
+	FMixerParsedChatMessage()
+		: UserId(0)
+		, UserLevel(0)
+		, bHasUserLevel(false)
+		, bIsWhisper(false)
+		, bIsAction(false)
+		, bIsFiltered(false)
+	{
+	}
+};
+
+/** One socket frame after parsing.  Chat messages are fully parsed; anything else is left as json for the regular handlers. */
+struct FMixerChatIngestItem
+{
+	FMixerParsedChatMessage ChatMessage;
+	TSharedPtr<FJsonObject> Json;
+	bool bIsChatMessage;
+
+	FMixerChatIngestItem()
+		: bIsChatMessage(false)
+	{
+	}
+};
+
+/**
+* Moves parsing of chat socket frames off the game thread.  Raw frames are queued by the
+* game thread and parsed in arrival order by at most one thread pool task at a time; results
+* come back through a second lock-free queue to be drained on the game thread.
+* In-flight tasks hold a reference, so the pipeline may outlive the connection that owns it.
+*/
+class FMixerChatIngestPipeline : public TSharedFromThis<FMixerChatIngestPipeline, ESPMode::ThreadSafe>
+{
+public:
+	/** Game thread: queue a raw frame for parsing */
+	void Enqueue(const FString& RawMessage);
+
+	/** Game thread: take the next parsed frame, if any */
+	bool Dequeue(FMixerChatIngestItem& OutItem);
+
+	/** Number of parsed chat messages waiting to be dequeued */
+	int32 GetNumQueuedChatMessages() const { return NumQueuedChatMessages.GetValue(); }
+
+	/**
+	* Game thread: count votes in subsequently parsed messages towards this vote, or none if null.
+	* Returns only once the worker has finished with the previous vote.
+	*/
+	void SetActiveVote(const TSharedPtr<FMixerChatVote, ESPMode::ThreadSafe>& Vote);
+
+	/** Game thread: filter subsequently parsed messages with this filter, or none if null */
+	void SetModerationFilter(const TSharedPtr<const FMixerChatModerationFilter, ESPMode::ThreadSafe>& Filter);
+
+private:
+	void ParseQueuedMessages();
+	void ParseSingleMessage(const FString& RawMessage);
+
+private:
+	TQueue<FString, EQueueMode::Spsc> RawMessages;
+	TQueue<FMixerChatIngestItem, EQueueMode::Spsc> ParsedMessages;
+
+	// Raw frames queued but not yet parsed.  The enqueue that takes this from 0 to 1 starts the worker,
+	// and the worker runs until it brings it back to 0, so there is only ever one consumer of RawMessages.
+	FThreadSafeCounter NumUnparsedMessages;
+	FThreadSafeCounter NumQueuedChatMessages;
+
+	FCriticalSection ActiveVoteLock;
+	TSharedPtr<FMixerChatVote, ESPMode::ThreadSafe> ActiveVote;
+
+	FCriticalSection ModerationFilterLock;
+	TSharedPtr<const FMixerChatModerationFilter, ESPMode::ThreadSafe> ModerationFilter;
+};
+
+namespace MixerChatIngest
+{
+	/**
+	* Extract the fields of a chat message event.  Safe to call from any thread.
+	*
+	* @param	JsonObj		The data object of a ChatMessage event, or an entry of a history reply.
+	* @param	OutMessage	Filled in with the message fields upon success.
+	*
+	* @Return	false if required fields were missing or malformed.
+	*/
+	bool ParseChatMessage(const FJsonObject* JsonObj, FMixerParsedChatMessage& OutMessage);
+}
@@ -0,0 +1,242 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerChatModerationFilter.h"
+#include "OnlineChatMixerPrivate.h"
+
+FMixerChatModerationFilter::FMixerChatModerationFilter(const TArray<FString>& Words, bool bInMatchWholeWords, bool bInMaskMatches)
+	: NumWords(0)
+	, bMatchWholeWords(bInMatchWholeWords)
+	, bMaskMatches(bInMaskMatches)
+{
+	// Insert into a trie with map-based children, which is convenient to build.
+	// It is flattened into sorted edge ranges below, which is cheaper to scan.
+	TArray<TMap<TCHAR, int32>> Children;
+	Children.AddDefaulted();
+	Nodes.AddZeroed();
+	for (const FString& Word : Words)
+	{
+		int32 Start = 0;
+		int32 End = Word.Len();
+		while (Start < End && FChar::IsWhitespace(Word[Start]))
+		{
+			++Start;
+		}
+		while (End > Start && FChar::IsWhitespace(Word[End - 1]))
+		{
+			--End;
+		}
+		if (Start == End)
+		{
+			continue;
+		}
+
+		int32 State = 0;
+		for (int32 i = Start; i < End; ++i)
+		{
+			const TCHAR Char = FChar::ToLower(Word[i]);
+			int32* Child = Children[State].Find(Char);
+			if (Child != nullptr)
+			{
+				State = *Child;
+			}
+			else
+			{
+				const int32 NewState = Nodes.AddZeroed();
+				Children.AddDefaulted();
+				Children[State].Add(Char, NewState);
+				State = NewState;
+			}
+		}
+
+		if (Nodes[State].MatchLength == 0)
+		{
+			Nodes[State].MatchLength = End - Start;
+			++NumWords;
+		}
+	}
+
+	// Fail links, breadth first so that every shorter suffix is resolved before it is needed
+	TArray<int32> Queue;
+	Queue.Reserve(Nodes.Num());
+	Nodes[0].NextMatch = INDEX_NONE;
+	for (const TPair<TCHAR, int32>& Edge : Children[0])
+	{
+		Nodes[Edge.Value].Fail = 0;
+		Nodes[Edge.Value].NextMatch = INDEX_NONE;
+		Queue.Add(Edge.Value);
+	}
+
+	for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+	{
+		const int32 Parent = Queue[QueueIndex];
+		for (const TPair<TCHAR, int32>& Edge : Children[Parent])
+		{
+			int32 Fail = Nodes[Parent].Fail;
+			int32* FailChild = Children[Fail].Find(Edge.Key);
+			while (FailChild == nullptr && Fail != 0)
+			{
+				Fail = Nodes[Fail].Fail;
+				FailChild = Children[Fail].Find(Edge.Key);
+			}
+
+			FNode& Node = Nodes[Edge.Value];
+			Node.Fail = FailChild != nullptr ? *FailChild : 0;
+			Node.NextMatch = Nodes[Node.Fail].MatchLength > 0 ? Node.Fail : Nodes[Node.Fail].NextMatch;
+			Queue.Add(Edge.Value);
+		}
+	}
+
+	Edges.Reserve(Nodes.Num() - 1);
+	for (int32 State = 0; State < Nodes.Num(); ++State)
+	{
+		TMap<TCHAR, int32>& StateChildren = Children[State];
+		StateChildren.KeySort(TLess<TCHAR>());
+
+		Nodes[State].FirstEdge = Edges.Num();
+		Nodes[State].NumEdges = StateChildren.Num();
+		for (const TPair<TCHAR, int32>& Child : StateChildren)
+		{
+			FEdge& Edge = Edges[Edges.AddUninitialized()];
+			Edge.Char = Child.Key;
+			Edge.Target = Child.Value;
+		}
+	}
+}
+
+bool FMixerChatModerationFilter::Apply(FMixerChatMessageContent& Content) const
+{
+	if (NumWords == 0)
+	{
+		return false;
+	}
+
+	bool bAnyMatched = false;
+	for (int32 i = 0; i < Content.Num(); ++i)
+	{
+		// Emoticon and tag text is not free-form, so is left alone
+		const EMixerChatFragmentType Type = Content.GetFragmentType(i);
+		if (Type == EMixerChatFragmentType::Text || Type == EMixerChatFragmentType::Link)
+		{
+			TArrayView<TCHAR> Text = Content.GetMutableFragmentText(i);
+			bool bMatched = ScanText(Text.GetData(), Text.Num());
+			if (Type == EMixerChatFragmentType::Link)
+			{
+				// A link whose text is masked would still lead to the same place, so the whole url goes too
+				TArrayView<TCHAR> Url = Content.GetMutableFragmentData(i);
+				bMatched = bMatched || ScanText(Url.GetData(), Url.Num());
+				if (bMatched && bMaskMatches)
+				{
+					for (TCHAR& Char : Url)
+					{
+						Char = TEXT('*');
+					}
+				}
+			}
+
+			if (bMatched)
+			{
+				bAnyMatched = true;
+				if (!bMaskMatches)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	return bAnyMatched;
+}
+
+bool FMixerChatModerationFilter::ScanText(TCHAR* Text, int32 TextLength) const
+{
+	// Masking is deferred until the scan is complete so that whole word checks see the original text
+	TArray<TPair<int32, int32>, TInlineAllocator<4>> MaskRanges;
+	int32 State = 0;
+	for (int32 End = 0; End < TextLength; ++End)
+	{
+		State = Step(State, FChar::ToLower(Text[End]));
+
+		// Longest first, so the first acceptable match covers every shorter one ending here
+		for (int32 Match = Nodes[State].MatchLength > 0 ? State : Nodes[State].NextMatch; Match != INDEX_NONE; Match = Nodes[Match].NextMatch)
+		{
+			const int32 Start = End - Nodes[Match].MatchLength + 1;
+			if (!bMatchWholeWords || IsWholeWord(Text, TextLength, Start, End))
+			{
+				if (!bMaskMatches)
+				{
+					return true;
+				}
+
+				if (MaskRanges.Num() > 0 && Start <= MaskRanges.Last().Value + 1)
+				{
+					MaskRanges.Last().Key = FMath::Min(MaskRanges.Last().Key, Start);
+					MaskRanges.Last().Value = End;
+				}
+				else
+				{
+					MaskRanges.Add(TPair<int32, int32>(Start, End));
+				}
+				break;
+			}
+		}
+	}
+
+	for (const TPair<int32, int32>& Range : MaskRanges)
+	{
+		for (int32 i = Range.Key; i <= Range.Value; ++i)
+		{
+			if (!FChar::IsWhitespace(Text[i]))
+			{
+				Text[i] = TEXT('*');
+			}
+		}
+	}
+
+	return MaskRanges.Num() > 0;
+}
+
+int32 FMixerChatModerationFilter::Step(int32 State, TCHAR Char) const
+{
+	for (;;)
+	{
+		// Binary search of this node's edges
+		const FNode& Node = Nodes[State];
+		int32 Low = Node.FirstEdge;
+		int32 High = Node.FirstEdge + Node.NumEdges;
+		while (Low < High)
+		{
+			const int32 Mid = Low + (High - Low) / 2;
+			if (Edges[Mid].Char < Char)
+			{
+				Low = Mid + 1;
+			}
+			else
+			{
+				High = Mid;
+			}
+		}
+
+		if (Low < Node.FirstEdge + Node.NumEdges && Edges[Low].Char == Char)
+		{
+			return Edges[Low].Target;
+		}
+
+		if (State == 0)
+		{
+			return 0;
+		}
+		State = Node.Fail;
+	}
+}
+
+bool FMixerChatModerationFilter::IsWholeWord(const TCHAR* Text, int32 TextLength, int32 Start, int32 End) const
+{
+	return (Start == 0 || !FChar::IsAlnum(Text[Start - 1])) && (End == TextLength - 1 || !FChar::IsAlnum(Text[End + 1]));
+}
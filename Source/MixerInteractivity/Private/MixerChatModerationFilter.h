@@ -0,0 +1,75 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMixerChatMessageContent;
+
+/**
+* Matches chat message text against a list of words and phrases, all at once, using an
+* Aho-Corasick automaton.  Scanning a message costs time proportional to its length
+* regardless of the size of the list.  Immutable once built, so one filter may be shared
+* by any number of threads; a changed list is applied by building a new filter.
+*/
+class FMixerChatModerationFilter
+{
+public:
+	/**
+	* @param	Words				Words or phrases to match, ignoring case.  Empty entries are ignored.
+	* @param	bInMatchWholeWords	Only match where the characters either side are not letters or digits.
+	* @param	bInMaskMatches		Overwrite matched text with '*' rather than only reporting the match.
+	*/
+	FMixerChatModerationFilter(const TArray<FString>& Words, bool bInMatchWholeWords, bool bInMaskMatches);
+
+	/**
+	* Scan the text and link fragments of a message, masking any matches if configured to.
+	* The url of a link that matched is masked in full.
+	*
+	* @Return	true if anything matched.
+	*/
+	bool Apply(FMixerChatMessageContent& Content) const;
+
+	int32 GetNumWords() const { return NumWords; }
+
+private:
+	bool ScanText(TCHAR* Text, int32 TextLength) const;
+	int32 Step(int32 State, TCHAR Char) const;
+	bool IsWholeWord(const TCHAR* Text, int32 TextLength, int32 Start, int32 End) const;
+
+private:
+	struct FNode
+	{
+		// Outgoing trie edges are Edges[FirstEdge, FirstEdge + NumEdges), sorted by character
+		int32 FirstEdge;
+		int32 NumEdges;
+
+		// Longest proper suffix of this node's string that is also in the trie
+		int32 Fail;
+
+		// Nearest node along the fail chain that ends a word, or INDEX_NONE
+		int32 NextMatch;
+
+		// Length of the word ending at this node, or 0 if none does
+		int32 MatchLength;
+	};
+
+	struct FEdge
+	{
+		TCHAR Char;
+		int32 Target;
+	};
+
+	TArray<FNode> Nodes;
+	TArray<FEdge> Edges;
+	int32 NumWords;
+	bool bMatchWholeWords;
+	bool bMaskMatches;
+};
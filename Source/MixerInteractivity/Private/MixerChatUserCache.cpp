@@ -0,0 +1,231 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerChatUserCache.h"
+#include "MixerInteractivityLog.h"
+
+FMixerChatUserCache::FMixerChatUserCache(int32 InCapacity)
+	: Capacity(FMath::Max(InCapacity, 0))
+	, EvictedRingNext(0)
+	, Head(INDEX_NONE)
+	, Tail(INDEX_NONE)
+	, FreeHead(INDEX_NONE)
+	, UserBytes(0)
+	, NumEvictions(0)
+	, NumHits(0)
+	, NumMisses(0)
+{
+	Slots.Reserve(Capacity);
+	SlotById.Reserve(Capacity);
+}
+
+TSharedPtr<FMixerChatUser> FMixerChatUserCache::Find(const FUniqueNetIdMixer& UserId)
+{
+	const int32* Slot = SlotById.Find(UserId);
+	if (Slot == nullptr)
+	{
+		++NumMisses;
+		return nullptr;
+	}
+
+	++NumHits;
+	if (*Slot != Head)
+	{
+		Unlink(*Slot);
+		LinkAtHead(*Slot);
+	}
+	return Slots[*Slot].User;
+}
+
+TSharedPtr<FMixerChatUser> FMixerChatUserCache::FindNoTouch(const FUniqueNetIdMixer& UserId) const
+{
+	const int32* Slot = SlotById.Find(UserId);
+	return Slot != nullptr ? Slots[*Slot].User : nullptr;
+}
+
+bool FMixerChatUserCache::WasEvicted(const FUniqueNetIdMixer& UserId) const
+{
+	return EvictedRingIndexById.Contains(UserId);
+}
+
+TSharedRef<FMixerChatUser> FMixerChatUserCache::Add(const FUniqueNetIdMixer& UserId, const FString& Name, int32 MixerId)
+{
+	check(!SlotById.Contains(UserId));
+	EvictedRingIndexById.Remove(UserId);
+
+	if (Capacity > 0 && SlotById.Num() >= Capacity && !EvictOne())
+	{
+		UE_LOG(LogMixerChat, Verbose, TEXT("All %d cached chat users are in use, growing the cache past its configured size"), SlotById.Num());
+	}
+
+	TSharedRef<FMixerChatUser> NewUser = MakeShared<FMixerChatUser>(Name, MixerId);
+	int32 Slot = AllocateSlot();
+	Slots[Slot].User = NewUser;
+	LinkAtHead(Slot);
+	SlotById.Add(UserId, Slot);
+	UserBytes += GetUserSize(NewUser.Get());
+	return NewUser;
+}
+
+TSharedPtr<FMixerChatUser> FMixerChatUserCache::Remove(const FUniqueNetIdMixer& UserId)
+{
+	int32 Slot;
+	if (!SlotById.RemoveAndCopyValue(UserId, Slot))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FMixerChatUser> RemovedUser = Slots[Slot].User;
+	UserBytes -= GetUserSize(*RemovedUser);
+	Unlink(Slot);
+	FreeSlot(Slot);
+	return RemovedUser;
+}
+
+bool FMixerChatUserCache::RemoveEvicted(const FUniqueNetIdMixer& UserId)
+{
+	return EvictedRingIndexById.Remove(UserId) > 0;
+}
+
+void FMixerChatUserCache::GetAll(TArray< TSharedRef<FChatRoomMember> >& OutUsers) const
+{
+	OutUsers.Reserve(OutUsers.Num() + SlotById.Num());
+	for (int32 Slot = Head; Slot != INDEX_NONE; Slot = Slots[Slot].Next)
+	{
+		OutUsers.Add(Slots[Slot].User.ToSharedRef());
+	}
+}
+
+void FMixerChatUserCache::GetStats(FMixerChatUserCacheStats& OutStats) const
+{
+	OutStats.NumUsers = SlotById.Num();
+	OutStats.NumPinnedUsers = 0;
+	for (int32 Slot = Head; Slot != INDEX_NONE; Slot = Slots[Slot].Next)
+	{
+		if (!Slots[Slot].User.IsUnique())
+		{
+			++OutStats.NumPinnedUsers;
+		}
+	}
+	OutStats.Capacity = Capacity;
+	OutStats.UserBytes = UserBytes;
+	OutStats.OverheadBytes = Slots.GetAllocatedSize() + SlotById.GetAllocatedSize() + EvictedRing.GetAllocatedSize() + EvictedRingIndexById.GetAllocatedSize();
+	OutStats.NumEvictions = NumEvictions;
+	OutStats.NumHits = NumHits;
+	OutStats.NumMisses = NumMisses;
+}
+
+int32 FMixerChatUserCache::AllocateSlot()
+{
+	if (FreeHead != INDEX_NONE)
+	{
+		int32 Slot = FreeHead;
+		FreeHead = Slots[Slot].Next;
+		return Slot;
+	}
+
+	return Slots.AddDefaulted();
+}
+
+void FMixerChatUserCache::FreeSlot(int32 Slot)
+{
+	Slots[Slot].User.Reset();
+	Slots[Slot].Prev = INDEX_NONE;
+	Slots[Slot].Next = FreeHead;
+	FreeHead = Slot;
+}
+
+void FMixerChatUserCache::LinkAtHead(int32 Slot)
+{
+	Slots[Slot].Prev = INDEX_NONE;
+	Slots[Slot].Next = Head;
+	if (Head != INDEX_NONE)
+	{
+		Slots[Head].Prev = Slot;
+	}
+	Head = Slot;
+	if (Tail == INDEX_NONE)
+	{
+		Tail = Slot;
+	}
+}
+
+void FMixerChatUserCache::Unlink(int32 Slot)
+{
+	FSlot& Entry = Slots[Slot];
+	if (Entry.Prev != INDEX_NONE)
+	{
+		Slots[Entry.Prev].Next = Entry.Next;
+	}
+	else
+	{
+		Head = Entry.Next;
+	}
+
+	if (Entry.Next != INDEX_NONE)
+	{
+		Slots[Entry.Next].Prev = Entry.Prev;
+	}
+	else
+	{
+		Tail = Entry.Prev;
+	}
+}
+
+bool FMixerChatUserCache::EvictOne()
+{
+	// Pinned users met on the way are moved to the head so that repeated
+	// evictions don't keep rescanning them.
+	for (int32 NumVisited = 0, NumUsers = SlotById.Num(); NumVisited < NumUsers; ++NumVisited)
+	{
+		int32 Slot = Tail;
+		Unlink(Slot);
+		if (Slots[Slot].User.IsUnique())
+		{
+			UE_LOG(LogMixerChat, VeryVerbose, TEXT("Evicting %s from chat user cache"), *Slots[Slot].User->Name);
+			SlotById.Remove(Slots[Slot].User->GetUniqueNetId());
+			RememberEvicted(Slots[Slot].User->GetUniqueNetId());
+			UserBytes -= GetUserSize(*Slots[Slot].User);
+			FreeSlot(Slot);
+			++NumEvictions;
+			return true;
+		}
+		LinkAtHead(Slot);
+	}
+
+	return false;
+}
+
+void FMixerChatUserCache::RememberEvicted(const FUniqueNetIdMixer& UserId)
+{
+	if (EvictedRing.Num() < Capacity)
+	{
+		EvictedRingIndexById.Add(UserId, EvictedRing.Add(UserId));
+		return;
+	}
+
+	// Full - the oldest entry is forgotten, unless that user has been evicted again more recently
+	const FUniqueNetIdMixer& OldestId = EvictedRing[EvictedRingNext];
+	const int32* OldestIndex = EvictedRingIndexById.Find(OldestId);
+	if (OldestIndex != nullptr && *OldestIndex == EvictedRingNext)
+	{
+		EvictedRingIndexById.Remove(OldestId);
+	}
+
+	EvictedRing[EvictedRingNext] = UserId;
+	EvictedRingIndexById.Add(UserId, EvictedRingNext);
+	EvictedRingNext = (EvictedRingNext + 1) % Capacity;
+}
+
+SIZE_T FMixerChatUserCache::GetUserSize(const FMixerChatUser& User)
+{
+	// The user and their net id are each a MakeShared allocation with an inline reference controller.
+	const SIZE_T ControllerSize = sizeof(SharedPointerInternals::FReferenceControllerBase);
+	return sizeof(FMixerChatUser) + sizeof(FUniqueNetIdMixer) + 2 * ControllerSize + User.Name.GetAllocatedSize();
+}
@@ -0,0 +1,89 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineChatMixerPrivate.h"
+
+/**
+* Bounded cache of the chat users a connection has seen, evicting least recently used
+* entries once full.  Users still referenced from outside the cache (by chat history,
+* an active poll or game code) are pinned and skipped by eviction.
+* Entries live in a slot array sized up front, linked into an intrusive LRU list by index,
+* so steady state churn does not allocate for bookkeeping.
+* Evicted users are still in the channel as far as join/exit events are concerned, so their
+* ids are remembered until they leave - or, if the leave is never seen, until Capacity more
+* users have been evicted.
+*/
+class FMixerChatUserCache
+{
+public:
+	/** @param	InCapacity	Number of users to keep before evicting.  0 for unbounded. */
+	explicit FMixerChatUserCache(int32 InCapacity);
+
+	/** Find a cached user and mark them as most recently used */
+	TSharedPtr<FMixerChatUser> Find(const FUniqueNetIdMixer& UserId);
+
+	/** Find a cached user without affecting eviction order */
+	TSharedPtr<FMixerChatUser> FindNoTouch(const FUniqueNetIdMixer& UserId) const;
+
+	/** True if the user was evicted without leaving, meaning their join has already been announced */
+	bool WasEvicted(const FUniqueNetIdMixer& UserId) const;
+
+	/** Add a user who is not already cached, evicting another if at capacity */
+	TSharedRef<FMixerChatUser> Add(const FUniqueNetIdMixer& UserId, const FString& Name, int32 MixerId);
+
+	/** Remove a user, returning them if they were cached */
+	TSharedPtr<FMixerChatUser> Remove(const FUniqueNetIdMixer& UserId);
+
+	/** Forget an evicted user who has now left.  Returns false if they had not been evicted. */
+	bool RemoveEvicted(const FUniqueNetIdMixer& UserId);
+
+	void GetAll(TArray< TSharedRef<FChatRoomMember> >& OutUsers) const;
+	void GetStats(FMixerChatUserCacheStats& OutStats) const;
+
+private:
+	struct FSlot
+	{
+		TSharedPtr<FMixerChatUser> User;
+		int32 Prev;
+		int32 Next;
+	};
+
+	int32 AllocateSlot();
+	void FreeSlot(int32 Slot);
+	void LinkAtHead(int32 Slot);
+	void Unlink(int32 Slot);
+	bool EvictOne();
+	void RememberEvicted(const FUniqueNetIdMixer& UserId);
+
+	static SIZE_T GetUserSize(const FMixerChatUser& User);
+
+private:
+	TArray<FSlot> Slots;
+	TMap<FUniqueNetIdMixer, int32> SlotById;
+	int32 Capacity;
+
+	// Ids of evicted users who have not left, in a ring of Capacity entries.  The map gives each
+	// id's position in the ring, so a stale ring entry doesn't forget a user evicted again since.
+	TArray<FUniqueNetIdMixer> EvictedRing;
+	TMap<FUniqueNetIdMixer, int32> EvictedRingIndexById;
+	int32 EvictedRingNext;
+
+	// Most recently used at the head.  Unused slots are chained through Next from FreeHead.
+	int32 Head;
+	int32 Tail;
+	int32 FreeHead;
+
+	SIZE_T UserBytes;
+	int32 NumEvictions;
+	int32 NumHits;
+	int32 NumMisses;
+};
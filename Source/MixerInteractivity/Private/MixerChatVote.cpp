@@ -0,0 +1,104 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerChatVote.h"
+
+namespace
+{
+	// Voters set is sized for a busy channel up front to avoid rehashing mid-vote
+	const int32 ExpectedVoters = 1024;
+}
+
+FMixerChatVote::FMixerChatVote(const TArray<FString>& InOptions, bool bInConsumeVoteMessages)
+	: Options(InOptions)
+	, bConsumeVoteMessages(bInConsumeVoteMessages)
+{
+	Tally.SetNum(Options.Num());
+	Voters.Reserve(ExpectedVoters);
+}
+
+bool FMixerChatVote::CountVote(int32 UserId, const FMixerChatMessageFragment& FirstFragment)
+{
+	const int32 Option = MatchFirstWord(FirstFragment);
+	if (Option == INDEX_NONE)
+	{
+		return false;
+	}
+
+	bool bAlreadyVoted = false;
+	Voters.Add(UserId, &bAlreadyVoted);
+	if (!bAlreadyVoted)
+	{
+		Tally[Option].Increment();
+	}
+	return true;
+}
+
+bool FMixerChatVote::IsVote(const FMixerChatMessageFragment& FirstFragment) const
+{
+	return MatchFirstWord(FirstFragment) != INDEX_NONE;
+}
+
+void FMixerChatVote::GetTally(TArray<int32>& OutVotes) const
+{
+	OutVotes.SetNumUninitialized(Tally.Num());
+	for (int32 i = 0; i < Tally.Num(); ++i)
+	{
+		OutVotes[i] = Tally[i].GetValue();
+	}
+}
+
+int32 FMixerChatVote::MatchFirstWord(const FMixerChatMessageFragment& FirstFragment) const
+{
+	if (FirstFragment.Type != EMixerChatFragmentType::Text)
+	{
+		return INDEX_NONE;
+	}
+
+	const TCHAR* Cursor = FirstFragment.Text;
+	const TCHAR* End = FirstFragment.Text + FirstFragment.TextLength;
+	while (Cursor < End && FChar::IsWhitespace(*Cursor))
+	{
+		++Cursor;
+	}
+	const TCHAR* WordStart = Cursor;
+	while (Cursor < End && !FChar::IsWhitespace(*Cursor))
+	{
+		++Cursor;
+	}
+
+	return MatchOption(WordStart, static_cast<int32>(Cursor - WordStart));
+}
+
+int32 FMixerChatVote::MatchOption(const TCHAR* Word, int32 WordLength) const
+{
+	if (WordLength == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 i = 0; i < Options.Num(); ++i)
+	{
+		if (Options[i].Len() == WordLength && FCString::Strnicmp(*Options[i], Word, WordLength) == 0)
+		{
+			return i;
+		}
+	}
+
+	int32 OptionNumber = 0;
+	for (int32 i = 0; i < WordLength; ++i)
+	{
+		if (!FChar::IsDigit(Word[i]) || OptionNumber > Options.Num())
+		{
+			return INDEX_NONE;
+		}
+		OptionNumber = OptionNumber * 10 + (Word[i] - TEXT('0'));
+	}
+	return OptionNumber >= 1 && OptionNumber <= Options.Num() ? OptionNumber - 1 : INDEX_NONE;
+}
@@ -0,0 +1,54 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineChatMixer.h"
+#include "HAL/ThreadSafeCounter.h"
+
+/**
+* Client side vote where every chat message whose first word names an option (or its
+* 1-based number) counts as a vote.  Each user's first vote is the one that counts.
+* Votes are counted by a single writer - the chat ingest thread, or the game thread if
+* chat is parsed there - while the tallies may be read from any thread.
+*/
+class FMixerChatVote
+{
+public:
+	FMixerChatVote(const TArray<FString>& InOptions, bool bInConsumeVoteMessages);
+
+	/**
+	* Count a message as a vote if it is one.  Writer thread only.
+	*
+	* @param	UserId			Mixer id of the sender.
+	* @param	FirstFragment	First fragment of the message.  Only its first word is inspected.
+	*
+	* @Return	true if the message named an option, whether or not it counted.
+	*/
+	bool CountVote(int32 UserId, const FMixerChatMessageFragment& FirstFragment);
+
+	/** Whether a message names an option, without counting it.  Safe from any thread. */
+	bool IsVote(const FMixerChatMessageFragment& FirstFragment) const;
+
+	void GetTally(TArray<int32>& OutVotes) const;
+
+	/** Whether messages that are votes should be kept out of normal chat delivery */
+	bool ConsumesVoteMessages() const { return bConsumeVoteMessages; }
+
+private:
+	int32 MatchFirstWord(const FMixerChatMessageFragment& FirstFragment) const;
+	int32 MatchOption(const TCHAR* Word, int32 WordLength) const;
+
+private:
+	TArray<FString> Options;
+	TArray<FThreadSafeCounter> Tally;
+	TSet<int32> Voters;
+	bool bConsumeVoteMessages;
+};
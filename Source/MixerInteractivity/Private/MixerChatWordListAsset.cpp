@@ -0,0 +1,37 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "MixerChatWordListAsset.h"
+
+FOnMixerChatWordListChanged UMixerChatWordListAsset::OnWordListChanged;
+
+UMixerChatWordListAsset::UMixerChatWordListAsset()
+	: bMatchWholeWords(true)
+{
+}
+
+void UMixerChatWordListAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	// Covers the list being reloaded in place, e.g. after being updated from source control
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		OnWordListChanged.Broadcast(this);
+	}
+}
+
+#if WITH_EDITOR
+void UMixerChatWordListAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	OnWordListChanged.Broadcast(this);
+}
+#endif
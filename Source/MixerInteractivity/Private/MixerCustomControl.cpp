@@ -9,18 +9,246 @@
 //*********************************************************
 #include "MixerCustomControl.h"
 #include "MixerDynamicDelegateBinding.h"
-#include "Containers/Ticker.h"
+#include "MixerInteractivityModulePrivate.h"
 #include "JsonObjectConverter.h"
 #include "Engine/World.h"
 #include "Engine/BlueprintGeneratedClass.h"
 
+/**
+* Precomputed recipe for finding and serializing changes to the client-writable
+* properties of a custom control class.  Plain-old-data properties that are adjacent
+* in the object are grouped into runs that can be compared with a single memcmp
+* against the last-sent copy; only the remaining properties need reflection to compare.
+*/
+struct FMixerCustomControlDiffPlan
+{
+	enum class EValueKind : uint8
+	{
+		Bool,
+		Integer,
+		FloatingPoint,
+		Reflected,
+	};
+
+	struct FEntry
+	{
+		UProperty* Property;
+		UNumericProperty* NumericProperty;
+		FString JsonKey;
+		int32 ObjectOffset;
+		int32 ShadowOffset;
+		EValueKind ValueKind;
+	};
+
+	struct FPodRun
+	{
+		int32 ObjectOffset;
+		int32 ShadowOffset;
+		int32 Size;
+		int32 FirstEntry;
+		int32 NumEntries;
+	};
+
+	// Identifies the property layout a plan was built for.  A Blueprint recompile keeps the
+	// same UClass but regenerates its properties, so the class alone is not enough.
+	struct FLayoutKey
+	{
+		const UProperty* Property;
+		const UClass* PropertyClass;
+		FName Name;
+		int32 Offset;
+		int32 Size;
+
+		explicit FLayoutKey(const UProperty* InProperty)
+			: Property(InProperty)
+			, PropertyClass(InProperty->GetClass())
+			, Name(InProperty->GetFName())
+			, Offset(InProperty->GetOffset_ForInternal())
+			, Size(InProperty->GetSize())
+		{
+		}
+
+		bool operator==(const FLayoutKey& Other) const
+		{
+			return Property == Other.Property && PropertyClass == Other.PropertyClass && Name == Other.Name && Offset == Other.Offset && Size == Other.Size;
+		}
+	};
+
+	// Entries covered by PodRuns come first, in run order
+	TArray<FEntry> Entries;
+	TArray<FPodRun> PodRuns;
+	int32 FirstReflectedEntry;
+	int32 ShadowSize;
+
+	// Result of GetClientWritableProperties the plan was built from, in the order returned
+	TArray<FLayoutKey> Layout;
+	int32 ClassPropertiesSize;
+
+	FMixerCustomControlDiffPlan(const UClass* ControlClass, TArray<UProperty*> Properties);
+
+	bool MatchesLayout(const UClass* ControlClass, const TArray<UProperty*>& Properties) const;
+};
+
+FMixerCustomControlDiffPlan::FMixerCustomControlDiffPlan(const UClass* ControlClass, TArray<UProperty*> Properties)
+	: FirstReflectedEntry(0)
+	, ShadowSize(0)
+	, ClassPropertiesSize(ControlClass->GetPropertiesSize())
+{
+	Layout.Reserve(Properties.Num());
+	for (const UProperty* Prop : Properties)
+	{
+		Layout.Emplace(Prop);
+	}
+
+	Properties.Sort([](const UProperty& A, const UProperty& B) { return A.GetOffset_ForInternal() < B.GetOffset_ForInternal(); });
+
+	TArray<FEntry> ReflectedEntries;
+	for (UProperty* Prop : Properties)
+	{
+		FEntry Entry;
+		Entry.Property = Prop;
+		Entry.NumericProperty = nullptr;
+		Entry.JsonKey = FJsonObjectConverter::StandardizeCase(Prop->GetName());
+		Entry.ObjectOffset = Prop->GetOffset_ForInternal();
+		Entry.ShadowOffset = 0;
+		Entry.ValueKind = EValueKind::Reflected;
+
+		UBoolProperty* BoolProp = Cast<UBoolProperty>(Prop);
+		UNumericProperty* NumericProp = Cast<UNumericProperty>(Prop);
+		if (Prop->ArrayDim == 1)
+		{
+			if (BoolProp != nullptr && BoolProp->IsNativeBool())
+			{
+				Entry.ValueKind = EValueKind::Bool;
+			}
+			else if (NumericProp != nullptr && !NumericProp->IsEnum())
+			{
+				Entry.NumericProperty = NumericProp;
+				Entry.ValueKind = NumericProp->IsFloatingPoint() ? EValueKind::FloatingPoint : EValueKind::Integer;
+			}
+		}
+
+		// Bitfield bools share their byte with other fields so can't be compared bytewise
+		if (!Prop->HasAnyPropertyFlags(CPF_IsPlainOldData) || (BoolProp != nullptr && !BoolProp->IsNativeBool()))
+		{
+			ReflectedEntries.Add(Entry);
+			continue;
+		}
+
+		FPodRun* Run = PodRuns.Num() > 0 ? &PodRuns.Last() : nullptr;
+		if (Run != nullptr && Run->ObjectOffset + Run->Size == Entry.ObjectOffset)
+		{
+			Entry.ShadowOffset = Run->ShadowOffset + Run->Size;
+			Run->Size += Prop->GetSize();
+			Run->NumEntries += 1;
+		}
+		else
+		{
+			FPodRun& NewRun = PodRuns[PodRuns.AddUninitialized()];
+			NewRun.ObjectOffset = Entry.ObjectOffset;
+			NewRun.ShadowOffset = ShadowSize;
+			NewRun.Size = Prop->GetSize();
+			NewRun.FirstEntry = Entries.Num();
+			NewRun.NumEntries = 1;
+			Entry.ShadowOffset = NewRun.ShadowOffset;
+		}
+
+		ShadowSize = Entry.ShadowOffset + Prop->GetSize();
+		Entries.Add(Entry);
+	}
+
+	// The shadow copies of POD runs are only ever compared and copied bytewise,
+	// but reflected values are operated on in place and must be aligned.
+	FirstReflectedEntry = Entries.Num();
+	for (FEntry& Entry : ReflectedEntries)
+	{
+		Entry.ShadowOffset = Align(ShadowSize, Entry.Property->GetMinAlignment());
+		ShadowSize = Entry.ShadowOffset + Entry.Property->GetSize();
+		Entries.Add(Entry);
+	}
+}
+
+bool FMixerCustomControlDiffPlan::MatchesLayout(const UClass* ControlClass, const TArray<UProperty*>& Properties) const
+{
+	if (ControlClass->GetPropertiesSize() != ClassPropertiesSize || Properties.Num() != Layout.Num())
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < Properties.Num(); ++i)
+	{
+		if (!(FLayoutKey(Properties[i]) == Layout[i]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+namespace
+{
+	TSharedRef<const FMixerCustomControlDiffPlan> GetDiffPlan(UMixerCustomControl* Control, const TArray<UProperty*>& Properties)
+	{
+		static TMap<TWeakObjectPtr<const UClass>, TSharedPtr<const FMixerCustomControlDiffPlan>> PlansByClass;
+
+		const UClass* ControlClass = Control->GetClass();
+		TSharedPtr<const FMixerCustomControlDiffPlan>* ExistingPlan = PlansByClass.Find(ControlClass);
+		if (ExistingPlan != nullptr && (*ExistingPlan)->MatchesLayout(ControlClass, Properties))
+		{
+			return ExistingPlan->ToSharedRef();
+		}
+
+		// Blueprint recompiles leave stale classes behind - drop their plans while we're here
+		for (TMap<TWeakObjectPtr<const UClass>, TSharedPtr<const FMixerCustomControlDiffPlan>>::TIterator It(PlansByClass); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		TSharedRef<const FMixerCustomControlDiffPlan> NewPlan = MakeShared<FMixerCustomControlDiffPlan>(ControlClass, Properties);
+
+		// Replaces any plan for an out of date layout of this class.  Instances still using it hold their own reference.
+		PlansByClass.Add(ControlClass, NewPlan);
+		return NewPlan;
+	}
+
+	void WriteChangedValue(FJsonObject& PendingUpdate, const FMixerCustomControlDiffPlan::FEntry& Entry, const void* Value)
+	{
+		switch (Entry.ValueKind)
+		{
+		case FMixerCustomControlDiffPlan::EValueKind::Bool:
+			PendingUpdate.SetBoolField(Entry.JsonKey, *static_cast<const bool*>(Value));
+			break;
+
+		case FMixerCustomControlDiffPlan::EValueKind::Integer:
+			PendingUpdate.SetNumberField(Entry.JsonKey, static_cast<double>(Entry.NumericProperty->GetSignedIntPropertyValue(Value)));
+			break;
+
+		case FMixerCustomControlDiffPlan::EValueKind::FloatingPoint:
+			PendingUpdate.SetNumberField(Entry.JsonKey, Entry.NumericProperty->GetFloatingPointPropertyValue(Value));
+			break;
+
+		case FMixerCustomControlDiffPlan::EValueKind::Reflected:
+		default:
+			PendingUpdate.SetField(Entry.JsonKey, FJsonObjectConverter::UPropertyToJsonValue(Entry.Property, Value, 0, 0));
+			break;
+		}
+	}
+}
+
 UMixerCustomControl::~UMixerCustomControl()
 {
-	uint8* CompactedPropertyLocation = LastSentPropertyData.GetData();
-	for (UProperty* ClientProp : ClientWritableProperties)
+	if (DiffPlan.IsValid())
 	{
-		ClientProp->DestroyValue(CompactedPropertyLocation);
-		CompactedPropertyLocation += ClientProp->GetSize();
+		uint8* ShadowData = LastSentPropertyData.GetData();
+		for (int32 i = DiffPlan->FirstReflectedEntry; i < DiffPlan->Entries.Num(); ++i)
+		{
+			const FMixerCustomControlDiffPlan::FEntry& Entry = DiffPlan->Entries[i];
+			Entry.Property->DestroyValue(ShadowData + Entry.ShadowOffset);
+		}
 	}
 }
 
@@ -36,29 +264,32 @@ void UMixerCustomControl::PostLoad()
 
 void UMixerCustomControl::InitClientWrittenPropertyMaintenance()
 {
-	ClientWritableProperties.Empty();
+	TArray<UProperty*> ClientWritableProperties;
 	GetClientWritableProperties(ClientWritableProperties);
-
-	int32 PropertyBlobRequiredSize = 0;
-	for (UProperty* ClientProp : ClientWritableProperties)
+	if (ClientWritableProperties.Num() == 0)
 	{
-		PropertyBlobRequiredSize += ClientProp->GetSize();
+		return;
 	}
 
-	LastSentPropertyData.AddUninitialized(PropertyBlobRequiredSize);
-	uint8* CompactedPropertyLocation = LastSentPropertyData.GetData();
-	for (UProperty* ClientProp : ClientWritableProperties)
+	DiffPlan = GetDiffPlan(this, ClientWritableProperties);
+
+	LastSentPropertyData.SetNumUninitialized(DiffPlan->ShadowSize);
+	uint8* ShadowData = LastSentPropertyData.GetData();
+	const uint8* ObjectData = reinterpret_cast<const uint8*>(this);
+	for (const FMixerCustomControlDiffPlan::FPodRun& Run : DiffPlan->PodRuns)
 	{
-		void* SourcePropertyValue = ClientProp->ContainerPtrToValuePtr<void>(this);
-		ClientProp->InitializeValue(CompactedPropertyLocation);
-		ClientProp->CopyCompleteValue(CompactedPropertyLocation, SourcePropertyValue);
-		CompactedPropertyLocation += ClientProp->GetSize();
+		FMemory::Memcpy(ShadowData + Run.ShadowOffset, ObjectData + Run.ObjectOffset, Run.Size);
 	}
 
-	if (ClientWritableProperties.Num() > 0)
+	for (int32 i = DiffPlan->FirstReflectedEntry; i < DiffPlan->Entries.Num(); ++i)
 	{
-		FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UMixerCustomControl::Tick), FMath::Max(ClientPropertyUpdateInterval, 0.0f));
+		const FMixerCustomControlDiffPlan::FEntry& Entry = DiffPlan->Entries[i];
+		Entry.Property->InitializeValue(ShadowData + Entry.ShadowOffset);
+		Entry.Property->CopyCompleteValue(ShadowData + Entry.ShadowOffset, ObjectData + Entry.ObjectOffset);
 	}
+
+	FMixerInteractivityModule& MixerModule = static_cast<FMixerInteractivityModule&>(IMixerInteractivityModule::Get());
+	MixerModule.RegisterCustomControl(this, ClientPropertyUpdateInterval);
 }
 
 void UMixerCustomControl::GetClientWritableProperties(TArray<UProperty*>& OutProperties)
@@ -67,7 +298,7 @@ void UMixerCustomControl::GetClientWritableProperties(TArray<UProperty*>& OutPro
 	{
 		if ((Prop->HasAnyPropertyFlags(CPF_BlueprintVisible) && !Prop->HasAnyPropertyFlags(CPF_BlueprintReadOnly)))
 		{
-			ClientWritableProperties.Add(Prop);
+			OutProperties.Add(Prop);
 		}
 	}
 }
@@ -81,26 +312,49 @@ bool UMixerCustomControl::Tick(float DeltaTime)
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> ControlJson;
-	uint8* CompactedPropertyLocation = LastSentPropertyData.GetData();
-	for (UProperty* ClientProp : ClientWritableProperties)
+	// Changes are written straight into the module's queued update for this control
+	TSharedPtr<FJsonObject> PendingUpdate;
+	auto GetPendingUpdate = [this, &PendingUpdate]() -> FJsonObject&
+	{
+		if (!PendingUpdate.IsValid())
+		{
+			FMixerInteractivityModule& MixerModule = static_cast<FMixerInteractivityModule&>(IMixerInteractivityModule::Get());
+			PendingUpdate = MixerModule.GetPendingControlUpdate(SceneName, ControlName);
+		}
+		return *PendingUpdate;
+	};
+
+	const FMixerCustomControlDiffPlan& Plan = *DiffPlan;
+	uint8* ShadowData = LastSentPropertyData.GetData();
+	const uint8* ObjectData = reinterpret_cast<const uint8*>(this);
+	for (const FMixerCustomControlDiffPlan::FPodRun& Run : Plan.PodRuns)
 	{
-		void* SourcePropertyValue = ClientProp->ContainerPtrToValuePtr<void>(this);
-		if (!ClientProp->Identical(SourcePropertyValue, CompactedPropertyLocation))
+		if (FMemory::Memcmp(ObjectData + Run.ObjectOffset, ShadowData + Run.ShadowOffset, Run.Size) == 0)
+		{
+			continue;
+		}
+
+		for (int32 i = Run.FirstEntry; i < Run.FirstEntry + Run.NumEntries; ++i)
 		{
-			if (!ControlJson.IsValid())
+			const FMixerCustomControlDiffPlan::FEntry& Entry = Plan.Entries[i];
+			if (FMemory::Memcmp(ObjectData + Entry.ObjectOffset, ShadowData + Entry.ShadowOffset, Entry.Property->GetSize()) != 0)
 			{
-				ControlJson = MakeShared<FJsonObject>();
+				WriteChangedValue(GetPendingUpdate(), Entry, ObjectData + Entry.ObjectOffset);
 			}
-			ControlJson->SetField(FJsonObjectConverter::StandardizeCase(ClientProp->GetName()), FJsonObjectConverter::UPropertyToJsonValue(ClientProp, SourcePropertyValue, 0, 0));
-			ClientProp->CopyCompleteValue(CompactedPropertyLocation, SourcePropertyValue);
 		}
-		CompactedPropertyLocation += ClientProp->GetSize();
+
+		FMemory::Memcpy(ShadowData + Run.ShadowOffset, ObjectData + Run.ObjectOffset, Run.Size);
 	}
 
-	if (ControlJson.IsValid())
+	for (int32 i = Plan.FirstReflectedEntry; i < Plan.Entries.Num(); ++i)
 	{
-		IMixerInteractivityModule::Get().UpdateRemoteControl(SceneName, ControlName, ControlJson.ToSharedRef());
+		const FMixerCustomControlDiffPlan::FEntry& Entry = Plan.Entries[i];
+		const void* SourcePropertyValue = ObjectData + Entry.ObjectOffset;
+		if (!Entry.Property->Identical(SourcePropertyValue, ShadowData + Entry.ShadowOffset))
+		{
+			WriteChangedValue(GetPendingUpdate(), Entry, SourcePropertyValue);
+			Entry.Property->CopyCompleteValue(ShadowData + Entry.ShadowOffset, SourcePropertyValue);
+		}
 	}
 
 	return true;
@@ -109,4 +363,4 @@ bool UMixerCustomControl::Tick(float DeltaTime)
 void UMixerCustomControl::NativeOnServerPropertiesUpdated()
 {
 	OnServerPropertiesUpdated();
-}
\ No newline at end of file
+}
@@ -11,6 +11,7 @@
 #include "MixerDynamicDelegateBinding.h"
 #include "MixerInteractivityLog.h"
 #include "MixerBindingUtils.h"
+#include "MixerBlueprintEventRouter.h"
 #include "MixerInteractivitySettings.h"
 #include "MixerInteractivityProjectAsset.h"
 #include "Engine/World.h"
@@ -24,64 +25,72 @@
 #include "Misc/UObjectToken.h"
 #include "Engine/BlueprintGeneratedClass.h"
 
-TArray<TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>> UMixerInteractivityBlueprintEventSource::BlueprintEventSources;
+namespace
+{
+	void AddRouteIfRegistered(UMixerInteractivityBlueprintEventSource* Source, EMixerBlueprintEventRoute Route, FName Name)
+	{
+		// Sources that aren't receiving events (e.g. in editor worlds) pick up their routes in RegisterForMixerEvents
+		if (Source->IsRegisteredForMixerEvents())
+		{
+			FMixerBlueprintEventRouter::Get().AddRoute(Route, Name, Source);
+		}
+	}
+}
 
 UMixerInteractivityBlueprintEventSource::UMixerInteractivityBlueprintEventSource(const FObjectInitializer& Initializer)
 	: Super(Initializer)
+	, bRegisteredForMixerEvents(false)
 {
 	UWorld* World = GetWorld();
 	if (World)
 	{
-		BlueprintEventSources.Add(TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>(this));
+		FMixerBlueprintEventRouter::Get().AddSource(this);
 		World->ExtraReferencedObjects.Add(this);
 	}
 }
 
 void UMixerInteractivityBlueprintEventSource::RegisterForMixerEvents()
 {
-	// Use GetModuleChecked here to avoid unsafe non-game thread warning
-	IMixerInteractivityModule& InteractivityModule = FModuleManager::GetModuleChecked<IMixerInteractivityModule>("MixerInteractivity");
-	if (ButtonDelegates.Num() > 0)
+	// Events are received via the router, which only forwards those for controls this source has bindings for
+	FMixerBlueprintEventRouter& Router = FMixerBlueprintEventRouter::Get();
+	for (TMap<FName, FMixerButtonEventDynamicDelegateWrapper>::TConstIterator It(ButtonDelegates); It; ++It)
 	{
-		InteractivityModule.OnButtonEvent().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnButtonNativeEvent);
+		Router.AddRoute(EMixerBlueprintEventRoute::Button, It->Key, this);
 	}
-	if (StickDelegates.Num() > 0)
+	for (TMap<FName, FMixerStickEventDynamicDelegateWrapper>::TConstIterator It(StickDelegates); It; ++It)
 	{
-		InteractivityModule.OnStickEvent().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnStickNativeEvent);
+		Router.AddRoute(EMixerBlueprintEventRoute::Stick, It->Key, this);
 	}
-	if (TextboxDelegates.Num() > 0)
+	for (TMap<FName, FMixerTextboxEventDynamicDelegateWrapper>::TConstIterator It(TextboxDelegates); It; ++It)
 	{
-		InteractivityModule.OnTextboxSubmitEvent().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnTextboxSubmitNativeEvent);
+		Router.AddRoute(EMixerBlueprintEventRoute::Textbox, It->Key, this);
 	}
-	if (CustomControlDelegates.Num() > 0)
+	for (TMap<FName, FMixerCustomControlDelegateWrapper>::TConstIterator It(CustomControlDelegates); It; ++It)
 	{
-		InteractivityModule.OnCustomControlInput().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnCustomControlInputNativeEvent);
-		InteractivityModule.OnCustomControlPropertyUpdate().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnCustomControlPropertyUpdateNativeEvent);
+		Router.AddRoute(EMixerBlueprintEventRoute::CustomControl, It->Key, this);
 	}
-	if (ParticipantJoinedDelegate.IsBound() || ParticipantLeftDelegate.IsBound() || ParticipantInputDisabledDelegate.IsBound())
+	for (TMap<FName, FMixerCustomMethodStubDelegateWrapper>::TConstIterator It(CustomMethodDelegates); It; ++It)
 	{
-		InteractivityModule.OnParticipantStateChanged().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnParticipantStateChangedNativeEvent);
+		Router.AddRoute(EMixerBlueprintEventRoute::CustomMethod, It->Key, this);
 	}
-	if (BroadcastingStartedDelegate.IsBound() || BroadcastingStoppedDelegate.IsBound())
+	if (ParticipantJoinedDelegate.IsBound() || ParticipantLeftDelegate.IsBound() || ParticipantInputDisabledDelegate.IsBound())
 	{
-		InteractivityModule.OnBroadcastingStateChanged().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnBroadcastingStateChangedNativeEvent);
+		Router.AddParticipantStateRoute(this);
 	}
-	if (CustomMethodDelegates.Num() > 0)
+	if (BroadcastingStartedDelegate.IsBound() || BroadcastingStoppedDelegate.IsBound())
 	{
-		InteractivityModule.OnCustomMethodCall().AddUObject(this, &UMixerInteractivityBlueprintEventSource::OnCustomMethodCallNativeEvent);
+		Router.AddBroadcastingStateRoute(this);
 	}
-}
 
+	bRegisteredForMixerEvents = true;
+}
 
 UMixerInteractivityBlueprintEventSource* UMixerInteractivityBlueprintEventSource::GetBlueprintEventSource(UWorld* ForWorld)
 {
-	for (int32 i = 0; i < BlueprintEventSources.Num(); ++i)
+	UMixerInteractivityBlueprintEventSource* ExistingSource = FMixerBlueprintEventRouter::Get().FindSourceForWorld(ForWorld);
+	if (ExistingSource != nullptr)
 	{
-		UMixerInteractivityBlueprintEventSource* ExistingSource = BlueprintEventSources[i].Get();
-		if (ExistingSource && ExistingSource->GetWorld() == ForWorld)
-		{
-			return ExistingSource;
-		}
+		return ExistingSource;
 	}
 
 	return NewObject<UMixerInteractivityBlueprintEventSource>(ForWorld);
@@ -90,12 +99,14 @@ UMixerInteractivityBlueprintEventSource* UMixerInteractivityBlueprintEventSource
 FMixerButtonEventDynamicDelegate* UMixerInteractivityBlueprintEventSource::GetButtonEvent(FName ButtonName, bool Pressed)
 {
 	FMixerButtonEventDynamicDelegateWrapper& DelegateWrapper = ButtonDelegates.FindOrAdd(ButtonName);
+	AddRouteIfRegistered(this, EMixerBlueprintEventRoute::Button, ButtonName);
 	return Pressed ? &DelegateWrapper.PressedDelegate : &DelegateWrapper.ReleasedDelegate;
 }
 
 void UMixerInteractivityBlueprintEventSource::AddCustomMethodBinding(FName EventName, UObject* TargetObject, FName TargetFunctionName)
 {
 	FMixerCustomMethodStubDelegateWrapper& DelegateWrapper = CustomMethodDelegates.FindOrAdd(EventName);
+	AddRouteIfRegistered(this, EMixerBlueprintEventRoute::CustomMethod, EventName);
 	FScriptDelegate SingleDelegate;
 	SingleDelegate.BindUFunction(TargetObject, TargetFunctionName);
 	DelegateWrapper.Delegate.AddUnique(SingleDelegate);
@@ -123,6 +134,7 @@ void UMixerInteractivityBlueprintEventSource::RemoveCustomMethodBinding(FName Ev
 void UMixerInteractivityBlueprintEventSource::AddTextSubmittedBinding(FName TextboxName, UObject* TargetObject, FName TargetFunctionName)
 {
 	FMixerTextboxEventDynamicDelegateWrapper& DelegateWrapper = TextboxDelegates.FindOrAdd(TextboxName);
+	AddRouteIfRegistered(this, EMixerBlueprintEventRoute::Textbox, TextboxName);
 	FScriptDelegate NewDelegate;
 	NewDelegate.BindUFunction(TargetObject, TargetFunctionName);
 	DelegateWrapper.SubmittedDelegate.AddUnique(NewDelegate);
@@ -144,16 +156,40 @@ void UMixerInteractivityBlueprintEventSource::RemoveTextSubmittedBinding(FName T
 FMixerStickEventDynamicDelegate* UMixerInteractivityBlueprintEventSource::GetStickEvent(FName StickName)
 {
 	FMixerStickEventDynamicDelegateWrapper& DelegateWrapper = StickDelegates.FindOrAdd(StickName);
+	AddRouteIfRegistered(this, EMixerBlueprintEventRoute::Stick, StickName);
 	return &DelegateWrapper.Delegate;
 }
 
+FMixerButtonBatchEventDynamicDelegate* UMixerInteractivityBlueprintEventSource::GetButtonBatchEvent(FName ButtonName, bool Pressed)
+{
+	FMixerButtonEventDynamicDelegateWrapper& DelegateWrapper = ButtonDelegates.FindOrAdd(ButtonName);
+	AddRouteIfRegistered(this, EMixerBlueprintEventRoute::Button, ButtonName);
+	return Pressed ? &DelegateWrapper.PressedBatchDelegate : &DelegateWrapper.ReleasedBatchDelegate;
+}
+
+FMixerStickBatchEventDynamicDelegate* UMixerInteractivityBlueprintEventSource::GetStickBatchEvent(FName StickName)
+{
+	FMixerStickEventDynamicDelegateWrapper& DelegateWrapper = StickDelegates.FindOrAdd(StickName);
+	AddRouteIfRegistered(this, EMixerBlueprintEventRoute::Stick, StickName);
+	return &DelegateWrapper.BatchDelegate;
+}
+
+FMixerTextSubmittedBatchEventDynamicDelegate* UMixerInteractivityBlueprintEventSource::GetTextSubmittedBatchEvent(FName TextboxName)
+{
+	FMixerTextboxEventDynamicDelegateWrapper& DelegateWrapper = TextboxDelegates.FindOrAdd(TextboxName);
+	AddRouteIfRegistered(this, EMixerBlueprintEventRoute::Textbox, TextboxName);
+	return &DelegateWrapper.SubmittedBatchDelegate;
+}
+
 FMixerCustomControlInputDynamicDelegate& UMixerInteractivityBlueprintEventSource::GetCustomControlInputEvent(FName ControlName)
 {
+	AddRouteIfRegistered(this, EMixerBlueprintEventRoute::CustomControl, ControlName);
 	return CustomControlDelegates.FindOrAdd(ControlName).InputDelegate;
 }
 
 FMixerCustomControlUpdateDynamicDelegate& UMixerInteractivityBlueprintEventSource::GetCustomControlUpdateEvent(FName ControlName)
 {
+	AddRouteIfRegistered(this, EMixerBlueprintEventRoute::CustomControl, ControlName);
 	return CustomControlDelegates.FindOrAdd(ControlName).UpdateDelegate;
 }
 
@@ -168,6 +204,17 @@ void UMixerInteractivityBlueprintEventSource::OnButtonNativeEvent(FName ButtonNa
 		FMixerTransactionId TransactionId;
 		TransactionId.Id = Details.TransactionId;
 		DelegateToFire.Broadcast(ButtonRef, static_cast<int32>(Participant->Id), TransactionId, static_cast<int32>(Details.SparkCost));
+
+		// The broadcast above may have added bindings and invalidated DelegateWrapper
+		DelegateWrapper = ButtonDelegates.Find(ButtonName);
+		if (DelegateWrapper != nullptr && (Details.Pressed ? DelegateWrapper->PressedBatchDelegate : DelegateWrapper->ReleasedBatchDelegate).IsBound())
+		{
+			FMixerButtonEventBatch& Batch = Details.Pressed ? DelegateWrapper->PendingPressed : DelegateWrapper->PendingReleased;
+			Batch.ParticipantIds.Add(static_cast<int32>(Participant->Id));
+			Batch.TransactionIds.Add(TransactionId);
+			Batch.SparkCosts.Add(static_cast<int32>(Details.SparkCost));
+			MarkBatchPending(PendingButtonBatches, ButtonName);
+		}
 	}
 }
 
@@ -179,6 +226,15 @@ void UMixerInteractivityBlueprintEventSource::OnStickNativeEvent(FName StickName
 		FMixerStickReference StickRef;
 		StickRef.Name = StickName;
 		DelegateWrapper->Delegate.Broadcast(StickRef, static_cast<int32>(Participant->Id), StickValue.X, StickValue.Y);
+
+		// The broadcast above may have added bindings and invalidated DelegateWrapper
+		DelegateWrapper = StickDelegates.Find(StickName);
+		if (DelegateWrapper != nullptr && DelegateWrapper->BatchDelegate.IsBound())
+		{
+			DelegateWrapper->Pending.ParticipantIds.Add(static_cast<int32>(Participant->Id));
+			DelegateWrapper->Pending.StickValues.Add(StickValue);
+			MarkBatchPending(PendingStickBatches, StickName);
+		}
 	}
 }
 
@@ -245,7 +301,7 @@ void UMixerInteractivityBlueprintEventSource::OnCustomControlInputNativeEvent(FN
 	{
 		if (Wrapper->MappedControl != nullptr)
 		{
-			UFunction* HandlerMethod = Wrapper->MappedControl->FindFunction(EventType);
+			UFunction* HandlerMethod = MixerBindingUtils::FindCustomEventHandler(Wrapper->MappedControl, EventType);
 			if (HandlerMethod != nullptr)
 			{
 				void* ParamStorage = FMemory_Alloca(HandlerMethod->ParmsSize);
@@ -277,7 +333,7 @@ void UMixerInteractivityBlueprintEventSource::OnCustomControlPropertyUpdateNativ
 	{
 		if (Wrapper->MappedControl != nullptr)
 		{
-			FJsonObjectConverter::JsonObjectToUStruct(UpdatedProperties, Wrapper->MappedControl->GetClass(), Wrapper->MappedControl);
+			MixerBindingUtils::ApplyPropertyUpdatesFromMessage(&UpdatedProperties.Get(), Wrapper->MappedControl);
 			Wrapper->MappedControl->NativeOnServerPropertiesUpdated();
 		}
 		else if (Wrapper->UpdateDelegate.IsBound())
@@ -306,6 +362,91 @@ void UMixerInteractivityBlueprintEventSource::OnTextboxSubmitNativeEvent(FName T
 		FMixerTransactionId TransactionId;
 		TransactionId.Id = Details.TransactionId;
 		DelegateWrapper->SubmittedDelegate.Broadcast(TextboxRef, static_cast<int32>(Participant->Id), Details.SubmittedText, TransactionId, Details.SparkCost);
+
+		// The broadcast above may have added bindings and invalidated DelegateWrapper
+		DelegateWrapper = TextboxDelegates.Find(TextboxName);
+		if (DelegateWrapper != nullptr && DelegateWrapper->SubmittedBatchDelegate.IsBound())
+		{
+			DelegateWrapper->Pending.ParticipantIds.Add(static_cast<int32>(Participant->Id));
+			DelegateWrapper->Pending.SubmittedTexts.Add(Details.SubmittedText);
+			DelegateWrapper->Pending.TransactionIds.Add(TransactionId);
+			DelegateWrapper->Pending.SparkCosts.Add(static_cast<int32>(Details.SparkCost));
+			MarkBatchPending(PendingTextboxBatches, TextboxName);
+		}
+	}
+}
+
+void UMixerInteractivityBlueprintEventSource::MarkBatchPending(TArray<FName>& PendingNames, FName ControlName)
+{
+	if (PendingButtonBatches.Num() == 0 && PendingStickBatches.Num() == 0 && PendingTextboxBatches.Num() == 0)
+	{
+		FMixerBlueprintEventRouter::Get().AddPendingBatchSource(this);
+	}
+	PendingNames.AddUnique(ControlName);
+}
+
+void UMixerInteractivityBlueprintEventSource::FlushBatchedEvents()
+{
+	// Batches are swapped out of the wrappers before broadcasting since handlers may add
+	// bindings (and so reallocate the wrapper maps) or generate further input.  Swapping
+	// rather than moving lets the wrappers and scratch batches keep their allocations.
+	static FMixerButtonEventBatch ButtonScratch;
+	static FMixerStickEventBatch StickScratch;
+	static FMixerTextSubmittedEventBatch TextboxScratch;
+
+	// Take the pending lists up front so that any input generated by handlers is picked up next frame
+	TArray<FName, TInlineAllocator<8>> ButtonNames(PendingButtonBatches);
+	TArray<FName, TInlineAllocator<8>> StickNames(PendingStickBatches);
+	TArray<FName, TInlineAllocator<8>> TextboxNames(PendingTextboxBatches);
+	PendingButtonBatches.Reset();
+	PendingStickBatches.Reset();
+	PendingTextboxBatches.Reset();
+
+	for (FName ButtonName : ButtonNames)
+	{
+		FMixerButtonReference ButtonRef;
+		ButtonRef.Name = ButtonName;
+		for (bool Pressed : { true, false })
+		{
+			FMixerButtonEventDynamicDelegateWrapper* DelegateWrapper = ButtonDelegates.Find(ButtonName);
+			if (DelegateWrapper != nullptr)
+			{
+				FMixerButtonEventBatch& Batch = Pressed ? DelegateWrapper->PendingPressed : DelegateWrapper->PendingReleased;
+				if (Batch.ParticipantIds.Num() > 0)
+				{
+					Swap(ButtonScratch, Batch);
+					FMixerButtonBatchEventDynamicDelegate& DelegateToFire = Pressed ? DelegateWrapper->PressedBatchDelegate : DelegateWrapper->ReleasedBatchDelegate;
+					DelegateToFire.Broadcast(ButtonRef, ButtonScratch.ParticipantIds, ButtonScratch.TransactionIds, ButtonScratch.SparkCosts);
+					ButtonScratch.Reset();
+				}
+			}
+		}
+	}
+
+	for (FName StickName : StickNames)
+	{
+		FMixerStickEventDynamicDelegateWrapper* DelegateWrapper = StickDelegates.Find(StickName);
+		if (DelegateWrapper != nullptr && DelegateWrapper->Pending.ParticipantIds.Num() > 0)
+		{
+			Swap(StickScratch, DelegateWrapper->Pending);
+			FMixerStickReference StickRef;
+			StickRef.Name = StickName;
+			DelegateWrapper->BatchDelegate.Broadcast(StickRef, StickScratch.ParticipantIds, StickScratch.StickValues);
+			StickScratch.Reset();
+		}
+	}
+
+	for (FName TextboxName : TextboxNames)
+	{
+		FMixerTextboxEventDynamicDelegateWrapper* DelegateWrapper = TextboxDelegates.Find(TextboxName);
+		if (DelegateWrapper != nullptr && DelegateWrapper->Pending.ParticipantIds.Num() > 0)
+		{
+			Swap(TextboxScratch, DelegateWrapper->Pending);
+			FMixerTextboxReference TextboxRef;
+			TextboxRef.Name = TextboxName;
+			DelegateWrapper->SubmittedBatchDelegate.Broadcast(TextboxRef, TextboxScratch.ParticipantIds, TextboxScratch.SubmittedTexts, TextboxScratch.TransactionIds, TextboxScratch.SparkCosts);
+			TextboxScratch.Reset();
+		}
 	}
 }
 
@@ -452,6 +593,13 @@ void UMixerInteractivityBlueprintEventSource::PostLoad()
 	}
 }
 
+void UMixerInteractivityBlueprintEventSource::BeginDestroy()
+{
+	FMixerBlueprintEventRouter::Get().RemoveSource(this);
+
+	Super::BeginDestroy();
+}
+
 UMixerCustomControl* UMixerInteractivityBlueprintEventSource::GetMappedCustomControl(FName ControlName)
 {
 	FMixerCustomControlDelegateWrapper* Wrapper = CustomControlDelegates.Find(ControlName);
@@ -491,12 +639,23 @@ void UMixerDelegateBinding::BindDynamicDelegates(UObject* InInstance) const
 
 	for (const FMixerButtonEventBinding& ButtonBinding : ButtonEventBindings)
 	{
-		FMixerButtonEventDynamicDelegate* Event = EventSource->GetButtonEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed);
-		if (Event)
+		FScriptDelegate Delegate;
+		Delegate.BindUFunction(InInstance, ButtonBinding.TargetFunctionName);
+		if (ButtonBinding.bBatched)
+		{
+			FMixerButtonBatchEventDynamicDelegate* Event = EventSource->GetButtonBatchEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed);
+			if (Event)
+			{
+				Event->AddUnique(Delegate);
+			}
+		}
+		else
 		{
-			FScriptDelegate Delegate;
-			Delegate.BindUFunction(InInstance, ButtonBinding.TargetFunctionName);
-			Event->AddUnique(Delegate);
+			FMixerButtonEventDynamicDelegate* Event = EventSource->GetButtonEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed);
+			if (Event)
+			{
+				Event->AddUnique(Delegate);
+			}
 		}
 	}
 
@@ -524,6 +683,30 @@ void UMixerDelegateBinding::BindDynamicDelegates(UObject* InInstance) const
 			EventSource->AddTextSubmittedBinding(GenericBinding.NameParam, InInstance, GenericBinding.TargetFunctionName);
 			break;
 
+		case EMixerGenericEventBindingType::StickBatch:
+			{
+				FMixerStickBatchEventDynamicDelegate* Event = EventSource->GetStickBatchEvent(GenericBinding.NameParam);
+				if (Event)
+				{
+					FScriptDelegate Delegate;
+					Delegate.BindUFunction(InInstance, GenericBinding.TargetFunctionName);
+					Event->AddUnique(Delegate);
+				}
+			}
+			break;
+
+		case EMixerGenericEventBindingType::TextSubmittedBatch:
+			{
+				FMixerTextSubmittedBatchEventDynamicDelegate* Event = EventSource->GetTextSubmittedBatchEvent(GenericBinding.NameParam);
+				if (Event)
+				{
+					FScriptDelegate Delegate;
+					Delegate.BindUFunction(InInstance, GenericBinding.TargetFunctionName);
+					Event->AddUnique(Delegate);
+				}
+			}
+			break;
+
 		default:
 			UE_LOG(LogMixerInteractivity, Error, TEXT("Failed to bind blueprint delegates with unknown binding type %d, target %s, name param %s"), static_cast<int32>(GenericBinding.BindingType), *GenericBinding.TargetFunctionName.ToString(), *GenericBinding.NameParam.ToString());
 			break;
@@ -589,10 +772,21 @@ void UMixerDelegateBinding::UnbindDynamicDelegates(UObject* InInstance) const
 	check(EventSource);
 	for (const FMixerButtonEventBinding& ButtonBinding : ButtonEventBindings)
 	{
-		FMixerButtonEventDynamicDelegate* Event = EventSource->GetButtonEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed);
-		if (Event)
+		if (ButtonBinding.bBatched)
 		{
-			Event->Remove(InInstance, ButtonBinding.TargetFunctionName);
+			FMixerButtonBatchEventDynamicDelegate* Event = EventSource->GetButtonBatchEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed);
+			if (Event)
+			{
+				Event->Remove(InInstance, ButtonBinding.TargetFunctionName);
+			}
+		}
+		else
+		{
+			FMixerButtonEventDynamicDelegate* Event = EventSource->GetButtonEvent(ButtonBinding.ButtonId, ButtonBinding.Pressed);
+			if (Event)
+			{
+				Event->Remove(InInstance, ButtonBinding.TargetFunctionName);
+			}
 		}
 	}
 
@@ -630,6 +824,26 @@ void UMixerDelegateBinding::UnbindDynamicDelegates(UObject* InInstance) const
 			EventSource->RemoveTextSubmittedBinding(GenericBinding.NameParam, InInstance, GenericBinding.TargetFunctionName);
 			break;
 
+		case EMixerGenericEventBindingType::StickBatch:
+			{
+				FMixerStickBatchEventDynamicDelegate* Event = EventSource->GetStickBatchEvent(GenericBinding.NameParam);
+				if (Event)
+				{
+					Event->Remove(InInstance, GenericBinding.TargetFunctionName);
+				}
+			}
+			break;
+
+		case EMixerGenericEventBindingType::TextSubmittedBatch:
+			{
+				FMixerTextSubmittedBatchEventDynamicDelegate* Event = EventSource->GetTextSubmittedBatchEvent(GenericBinding.NameParam);
+				if (Event)
+				{
+					Event->Remove(InInstance, GenericBinding.TargetFunctionName);
+				}
+			}
+			break;
+
 		default:
 			UE_LOG(LogMixerInteractivity, Error, TEXT("Failed to unbind blueprint delegates with unknown binding type %d, target %s, name param %s"), static_cast<int32>(GenericBinding.BindingType), *GenericBinding.TargetFunctionName.ToString(), *GenericBinding.NameParam.ToString());
 			break;
@@ -207,6 +207,69 @@ void UMixerInteractivityBlueprintLibrary::GetButtonState(FMixerButtonReference B
 	}
 }
 
+void UMixerInteractivityBlueprintLibrary::StartVoteTally(FName TallyName, const TArray<FMixerButtonReference>& Options, FTimespan Window, bool SlidingWindow, bool UniqueVoters)
+{
+	TArray<FName> OptionNames;
+	OptionNames.Reserve(Options.Num());
+	for (const FMixerButtonReference& Option : Options)
+	{
+		OptionNames.Add(Option.Name);
+	}
+	IMixerInteractivityModule::Get().StartVoteTally(TallyName, OptionNames, Window, SlidingWindow, UniqueVoters);
+}
+
+void UMixerInteractivityBlueprintLibrary::StopVoteTally(FName TallyName)
+{
+	IMixerInteractivityModule::Get().StopVoteTally(TallyName);
+}
+
+void UMixerInteractivityBlueprintLibrary::GetVoteTally(FName TallyName, TArray<int32>& Counts, int32& LeadingOption, FMixerGroupReference Group, bool LastCompletedWindow)
+{
+	LeadingOption = -1;
+	if (!IMixerInteractivityModule::Get().GetVoteTally(TallyName, Group.Name, LastCompletedWindow, Counts))
+	{
+		Counts.Empty();
+		return;
+	}
+
+	int32 LeadingCount = 0;
+	for (int32 i = 0; i < Counts.Num(); ++i)
+	{
+		if (Counts[i] > LeadingCount)
+		{
+			LeadingCount = Counts[i];
+			LeadingOption = i;
+		}
+	}
+}
+
+void UMixerInteractivityBlueprintLibrary::StartHeatMap(FName Control, int32 Width, int32 Height, FVector2D BoundsMin, FVector2D BoundsMax, FTimespan HalfLife)
+{
+	IMixerInteractivityModule::Get().StartHeatMap(Control, Width, Height, FBox2D(BoundsMin, BoundsMax), HalfLife);
+}
+
+void UMixerInteractivityBlueprintLibrary::StopHeatMap(FName Control)
+{
+	IMixerInteractivityModule::Get().StopHeatMap(Control);
+}
+
+void UMixerInteractivityBlueprintLibrary::GetHeatMap(FName Control, int32& Width, int32& Height, TArray<float>& Values, float& MaxValue)
+{
+	TArrayView<const float> HeatMapValues;
+	if (IMixerInteractivityModule::Get().GetHeatMap(Control, Width, Height, HeatMapValues, MaxValue))
+	{
+		Values.Reset(HeatMapValues.Num());
+		Values.Append(HeatMapValues.GetData(), HeatMapValues.Num());
+	}
+	else
+	{
+		Width = 0;
+		Height = 0;
+		Values.Empty();
+		MaxValue = 0.0f;
+	}
+}
+
 void UMixerInteractivityBlueprintLibrary::GetStickDescription(FMixerStickReference Stick, FText& HelpText)
 {
 	FMixerStickDescription StickDesc;
@@ -243,6 +306,20 @@ void UMixerInteractivityBlueprintLibrary::GetStickState(FMixerStickReference Sti
 	}
 }
 
+void UMixerInteractivityBlueprintLibrary::GetStickStatistics(FMixerStickReference Stick, int32& ActiveParticipants, FVector2D& Mean, FVector2D& Variance, FVector2D& LevelWeightedMean, TArray<int32>& DirectionHistogram, float& MagnitudeAtPercentile, int32 DirectionBuckets, float Percentile)
+{
+	FMixerStickStatistics Stats;
+	IMixerInteractivityModule::Get().GetStickStatistics(Stick.Name, DirectionBuckets, Percentile, Stats);
+
+	// Stats stays default-initialized (all zeroes) on failure
+	ActiveParticipants = Stats.ActiveParticipants;
+	Mean = Stats.Mean;
+	Variance = Stats.Variance;
+	LevelWeightedMean = Stats.LevelWeightedMean;
+	DirectionHistogram = MoveTemp(Stats.DirectionHistogram);
+	MagnitudeAtPercentile = Stats.MagnitudeAtPercentile;
+}
+
 void UMixerInteractivityBlueprintLibrary::SetLabelText(FMixerLabelReference Label, const FText& Text)
 {
 	IMixerInteractivityModule::Get().SetLabelText(Label.Name, Text);
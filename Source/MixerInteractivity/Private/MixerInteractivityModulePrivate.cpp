@@ -13,7 +13,9 @@
 #include "MixerDynamicDelegateBinding.h"
 #include "MixerInteractivityLog.h"
 #include "MixerBindingUtils.h"
+#include "MixerJsonHelpers.h"
 #include "MixerInteractivityProjectAsset.h"
+#include "MixerCustomControl.h"
 #include "OnlineChatMixerPrivate.h"
 #include "OnlineChatMixerPrivate.h"
 
@@ -35,6 +37,7 @@
 #include "Framework/Docking/TabManager.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Misc/App.h"
+#include "HAL/PlatformTime.h"
 #include "Engine/Engine.h"
 #include "OnlineSubsystemTypes.h"
 
@@ -62,8 +65,15 @@ void FMixerInteractivityModule::StartupModule()
 	InteractiveConnectionAuthState = EMixerLoginState::Not_Logged_In;
 	InteractivityState = EMixerInteractivityState::Not_Interactive;
 
+	ParticipantNotificationsThisFrame = 0;
+
 	ChatInterface = MakeShared<FOnlineChatMixer>();
 
+#if WITH_EDITOR
+	// Blueprint compiles replace properties and functions that may be cached for custom controls
+	PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddStatic(&MixerBindingUtils::FlushBinderCaches);
+#endif
+
 #if PLATFORM_XBOXONE
 	check(FSlateApplication::IsInitialized());
 	static_cast<FXboxOneInputInterface*>(FSlateApplication::Get().GetInputInterface())->OnUserRemovedDelegates.AddRaw(this, &FMixerInteractivityModule::OnXboxUserRemoved);
@@ -82,6 +92,10 @@ void FMixerInteractivityModule::StartupModule()
 
 void FMixerInteractivityModule::ShutdownModule()
 {
+#if WITH_EDITOR
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+#endif
+
 #if PLATFORM_XBOXONE
 	check(FSlateApplication::IsInitialized());
 	static_cast<FXboxOneInputInterface*>(FSlateApplication::Get().GetInputInterface())->OnUserRemovedDelegates.RemoveAll(this);
@@ -338,7 +352,10 @@ bool FMixerInteractivityModule::Tick(float DeltaTime)
 	TickXboxLogin();
 #endif
 
+	ParticipantNotificationsThisFrame = 0;
+
 	TickLocalUserMaintenance();
+	TickCustomControls();
 	FlushControlUpdates();
 
 	if (!NeedsClientLibraryActive())
@@ -351,6 +368,60 @@ bool FMixerInteractivityModule::Tick(float DeltaTime)
 
 }
 
+void FMixerInteractivityModule::QueueParticipantStateChange(TSharedPtr<const FMixerRemoteUser> User, EMixerInteractivityParticipantState State)
+{
+	FMixerPendingParticipantChange& Change = PendingParticipantChanges[PendingParticipantChanges.AddDefaulted()];
+	Change.User = User;
+	Change.State = State;
+}
+
+void FMixerInteractivityModule::FlushParticipantStateChanges()
+{
+	const int32 MaxPerFrame = GetDefault<UMixerInteractivitySettings>()->MaxParticipantNotificationsPerFrame;
+	const int32 Budget = MaxPerFrame > 0 ? FMath::Max(MaxPerFrame - ParticipantNotificationsThisFrame, 0) : MAX_int32;
+	const int32 NumToDeliver = FMath::Min(PendingParticipantChanges.Num(), Budget);
+	if (NumToDeliver == 0)
+	{
+		return;
+	}
+
+	// Deliver runs of participants sharing a state change as a single batch
+	int32 RunStart = 0;
+	while (RunStart < NumToDeliver)
+	{
+		const EMixerInteractivityParticipantState RunState = PendingParticipantChanges[RunStart].State;
+		int32 RunEnd = RunStart;
+		ParticipantBatchScratch.Reset();
+		while (RunEnd < NumToDeliver && PendingParticipantChanges[RunEnd].State == RunState)
+		{
+			ParticipantBatchScratch.Add(PendingParticipantChanges[RunEnd].User);
+			++RunEnd;
+		}
+
+		OnParticipantsChanged().Broadcast(ParticipantBatchScratch, RunState);
+
+		if (OnParticipantStateChanged().IsBound())
+		{
+			for (const TSharedPtr<const FMixerRemoteUser>& User : ParticipantBatchScratch)
+			{
+				OnParticipantStateChanged().Broadcast(User, RunState);
+			}
+		}
+
+		RunStart = RunEnd;
+	}
+	ParticipantBatchScratch.Reset();
+
+	PendingParticipantChanges.RemoveAt(0, NumToDeliver, false);
+	ParticipantNotificationsThisFrame += NumToDeliver;
+}
+
+void FMixerInteractivityModule::DiscardParticipantStateChanges()
+{
+	// Changes belong to the session that produced them
+	PendingParticipantChanges.Empty();
+}
+
 void FMixerInteractivityModule::TickLocalUserMaintenance()
 {
 	if (NeedsClientLibraryActive() && CurrentUser.IsValid())
@@ -629,24 +700,64 @@ void FMixerInteractivityModule::HandleCustomControlInputMessage(FJsonObject* Par
 
 void FMixerInteractivityModule::UpdateRemoteControl(FName SceneName, FName ControlName, TSharedRef<FJsonObject> PropertiesToUpdate)
 {
-	// @TODO - centralize field name constants
-	static const FString ControlIdField = TEXT("controlID");
+	GetPendingControlUpdate(SceneName, ControlName)->Values.Append(PropertiesToUpdate->Values);
+}
+
+TSharedRef<FJsonObject> FMixerInteractivityModule::GetPendingControlUpdate(FName SceneName, FName ControlName)
+{
+	TSharedPtr<FJsonObject>& UpdateObject = PendingControlUpdatesByControl.FindOrAdd(TPair<FName, FName>(SceneName, ControlName));
+	if (!UpdateObject.IsValid())
+	{
+		UpdateObject = MakeShared<FJsonObject>();
+		UpdateObject->SetStringField(MixerStringConstants::FieldNames::ControlId, ControlName.ToString());
+		PendingControlUpdates.FindOrAdd(SceneName).Add(MakeShared<FJsonValueObject>(UpdateObject));
+	}
 
-	FString ControlNameString = ControlName.ToString();
+	return UpdateObject.ToSharedRef();
+}
 
-	TArray<TSharedPtr<FJsonValue>>& ControlsForScene = PendingControlUpdates.FindOrAdd(SceneName);
-	for (TSharedPtr<FJsonValue>& ExistingControlUpdate : ControlsForScene)
+void FMixerInteractivityModule::RegisterCustomControl(UMixerCustomControl* Control, float UpdateInterval)
+{
+	UpdateInterval = FMath::Max(UpdateInterval, 0.0f);
+
+	FCustomControlSyncBucket* Bucket = CustomControlSyncBuckets.FindByPredicate([UpdateInterval](const FCustomControlSyncBucket& Candidate) { return Candidate.Interval == UpdateInterval; });
+	if (Bucket == nullptr)
 	{
-		TSharedPtr<FJsonObject> UpdateObject = ExistingControlUpdate->AsObject();
-		if (UpdateObject->GetStringField(ControlIdField) == ControlNameString)
+		Bucket = &CustomControlSyncBuckets[CustomControlSyncBuckets.AddDefaulted()];
+		Bucket->Interval = UpdateInterval;
+		Bucket->LastSyncTime = FPlatformTime::Seconds();
+	}
+
+	Bucket->Controls.AddUnique(Control);
+}
+
+void FMixerInteractivityModule::TickCustomControls()
+{
+	const double TimeNow = FPlatformTime::Seconds();
+	for (int32 BucketIndex = CustomControlSyncBuckets.Num() - 1; BucketIndex >= 0; --BucketIndex)
+	{
+		FCustomControlSyncBucket& Bucket = CustomControlSyncBuckets[BucketIndex];
+		const float Elapsed = static_cast<float>(TimeNow - Bucket.LastSyncTime);
+		if (Elapsed < Bucket.Interval)
 		{
-			UpdateObject->Values.Append(PropertiesToUpdate->Values);
-			return;
+			continue;
 		}
-	}
 
-	PropertiesToUpdate->SetStringField(ControlIdField, ControlName.ToString());
-	ControlsForScene.Add(MakeShared<FJsonValueObject>(PropertiesToUpdate));
+		Bucket.LastSyncTime = TimeNow;
+		for (int32 i = Bucket.Controls.Num() - 1; i >= 0; --i)
+		{
+			UMixerCustomControl* Control = Bucket.Controls[i].Get();
+			if (Control == nullptr || !Control->Tick(Elapsed))
+			{
+				Bucket.Controls.RemoveAtSwap(i, 1, false);
+			}
+		}
+
+		if (Bucket.Controls.Num() == 0)
+		{
+			CustomControlSyncBuckets.RemoveAtSwap(BucketIndex);
+		}
+	}
 }
 
 void FMixerInteractivityModule::FlushControlUpdates()
@@ -663,6 +774,7 @@ void FMixerInteractivityModule::FlushControlUpdates()
 	}
 
 	PendingControlUpdates.Empty();
+	PendingControlUpdatesByControl.Reset();
 }
 
 TSharedPtr<IOnlineChat> FMixerInteractivityModule::GetChatInterface()
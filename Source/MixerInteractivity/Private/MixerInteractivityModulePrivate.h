@@ -78,6 +78,12 @@ class IWebBrowserWindow;
 class IWebBrowserPopupFeatures;
 class UMixerInteractivityBlueprintEventSource;
 
+struct FMixerPendingParticipantChange
+{
+	TSharedPtr<const FMixerRemoteUser> User;
+	EMixerInteractivityParticipantState State;
+};
+
 class FMixerInteractivityModule :
 	public IMixerInteractivityModule,
 	public FTickerObjectBase
@@ -105,6 +111,8 @@ public:
 	virtual FOnLoginStateChanged& OnLoginStateChanged()							{ return LoginStateChanged; }
 	virtual FOnInteractivityStateChanged& OnInteractivityStateChanged()			{ return InteractivityStateChanged; }
 	virtual FOnParticipantStateChangedEvent& OnParticipantStateChanged()		{ return ParticipantStateChanged; }
+	virtual FOnParticipantsChangedEvent& OnParticipantsChanged()				{ return ParticipantsChanged; }
+	virtual FOnParticipantSyncProgressEvent& OnParticipantSyncProgress()		{ return ParticipantSyncProgress; }
 	virtual FOnButtonEvent& OnButtonEvent()										{ return ButtonEvent; }
 	virtual FOnStickEvent& OnStickEvent()										{ return StickEvent; }
 	virtual FOnBroadcastingStateChanged& OnBroadcastingStateChanged()			{ return BroadcastingStateChanged; }
@@ -119,6 +127,19 @@ public:
 public:
 	void UpdateRemoteControl(FName SceneName, FName ControlName, TSharedRef<FJsonObject> PropertiesToUpdate);
 
+	/**
+	* Get the queued (not yet flushed) property update for a control, creating an empty one if needed.
+	* Changed values may be written straight into the returned object.
+	*/
+	TSharedRef<FJsonObject> GetPendingControlUpdate(FName SceneName, FName ControlName);
+
+	/**
+	* Add a custom control to the shared property sync schedule.  Controls with the same
+	* update interval are checked together, and the resulting changes go out in a single
+	* updateControls message per scene.  Controls are dropped automatically once destroyed.
+	*/
+	void RegisterCustomControl(class UMixerCustomControl* Control, float UpdateInterval);
+
 protected:
 	virtual bool StartInteractiveConnection() = 0;
 	virtual void StopInteractiveConnection() = 0;
@@ -130,6 +151,15 @@ protected:
 	Windows::Xbox::System::User^ GetXboxUser()							{ return XboxUserOperation.Get(); }
 #endif
 
+	/**
+	* Participant changes are queued and delivered in batches via OnParticipantsChanged (and
+	* OnParticipantStateChanged) within the per-frame limit from project settings.  Backends
+	* should flush after processing a burst of incoming changes.
+	*/
+	void QueueParticipantStateChange(TSharedPtr<const FMixerRemoteUser> User, EMixerInteractivityParticipantState State);
+	void FlushParticipantStateChanges();
+	void DiscardParticipantStateChanges();
+
 	bool HandleControlUpdateMessage(FJsonObject* ParamsJson);
 	void HandleCustomControlInputMessage(FJsonObject* ParamsJson);
 
@@ -156,6 +186,7 @@ private:
 	void InitDesignTimeGroups();
 
 	void TickLocalUserMaintenance();
+	void TickCustomControls();
 	void FlushControlUpdates();
 
 private:
@@ -183,6 +214,8 @@ private:
 	FOnLoginStateChanged LoginStateChanged;
 	FOnInteractivityStateChanged InteractivityStateChanged;
 	FOnParticipantStateChangedEvent ParticipantStateChanged;
+	FOnParticipantsChangedEvent ParticipantsChanged;
+	FOnParticipantSyncProgressEvent ParticipantSyncProgress;
 	FOnButtonEvent ButtonEvent;
 	FOnStickEvent StickEvent;
 	FOnBroadcastingStateChanged BroadcastingStateChanged;
@@ -193,7 +226,25 @@ private:
 
 	TSharedPtr<class FOnlineChatMixer> ChatInterface;
 
+	TArray<FMixerPendingParticipantChange> PendingParticipantChanges;
+	TArray<TSharedPtr<const FMixerRemoteUser>> ParticipantBatchScratch;
+	int32 ParticipantNotificationsThisFrame;
+
 	TMap<FName, TArray<TSharedPtr<FJsonValue>>> PendingControlUpdates;
+	TMap<TPair<FName, FName>, TSharedPtr<FJsonObject>> PendingControlUpdatesByControl;
+
+	struct FCustomControlSyncBucket
+	{
+		float Interval;
+		double LastSyncTime;
+		TArray<TWeakObjectPtr<class UMixerCustomControl>> Controls;
+	};
+
+	TArray<FCustomControlSyncBucket> CustomControlSyncBuckets;
+
+#if WITH_EDITOR
+	FDelegateHandle PreGarbageCollectHandle;
+#endif
 
 	bool RetryLoginWithUI;
 };
\ No newline at end of file
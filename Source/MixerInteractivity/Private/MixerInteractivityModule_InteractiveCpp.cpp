@@ -98,6 +98,7 @@ void FMixerInteractivityModule_InteractiveCpp::StopInteractiveConnection()
 	{
 		SetInteractiveConnectionAuthState(EMixerLoginState::Not_Logged_In);
 		RemoteParticipantCache.Empty();
+		DiscardParticipantStateChanges();
 	}
 }
 
@@ -170,15 +171,15 @@ bool FMixerInteractivityModule_InteractiveCpp::Tick(float DeltaTime)
 				switch (ParticipantEventArgs->state())
 				{
 				case interactive_participant_state::joined:
-					OnParticipantStateChanged().Broadcast(RemoteParticipant, EMixerInteractivityParticipantState::Joined);
+					QueueParticipantStateChange(RemoteParticipant, EMixerInteractivityParticipantState::Joined);
 					break;
 
 				case interactive_participant_state::left:
-					OnParticipantStateChanged().Broadcast(RemoteParticipant, EMixerInteractivityParticipantState::Left);
+					QueueParticipantStateChange(RemoteParticipant, EMixerInteractivityParticipantState::Left);
 					break;
 
 				case interactive_participant_state::input_disabled:
-					OnParticipantStateChanged().Broadcast(RemoteParticipant, EMixerInteractivityParticipantState::Input_Disabled);
+					QueueParticipantStateChange(RemoteParticipant, EMixerInteractivityParticipantState::Input_Disabled);
 					break;
 
 				default:
@@ -213,6 +214,9 @@ bool FMixerInteractivityModule_InteractiveCpp::Tick(float DeltaTime)
 		}
 	}
 
+	// Participant events arrive one at a time - deliver whatever this frame produced as a batch
+	FlushParticipantStateChanges();
+
 	TickParticipantCacheMaintenance();
 
 	return true;
@@ -22,6 +22,50 @@ IMPLEMENT_MODULE(FMixerInteractivityModule_InteractiveCpp2, MixerInteractivity);
 
 namespace
 {
+	// Find a key (including its quotes) in raw json without decoding the document.  Only
+	// matches followed by a colon count, so string values that happen to match are skipped.
+	const char* FindJsonKey(const char* Begin, const char* End, const char* QuotedKey, int32 KeyLength)
+	{
+		for (const char* Cursor = Begin; Cursor + KeyLength <= End; ++Cursor)
+		{
+			if (*Cursor == '"' && FMemory::Memcmp(Cursor, QuotedKey, KeyLength) == 0)
+			{
+				const char* AfterKey = Cursor + KeyLength;
+				while (AfterKey < End && FCharAnsi::IsWhitespace(*AfterKey))
+				{
+					++AfterKey;
+				}
+				if (AfterKey < End && *AfterKey == ':')
+				{
+					return Cursor;
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	// interactive-cpp-v2 leaves coordinateData zeroed when a click carries no position, so a
+	// click at the origin has to be told apart from one without a position using the raw params.
+	// This runs for every button press, so it scans the buffer rather than parsing it.
+	bool InputHasClickCoordinates(const interactive_input* Input)
+	{
+		if (Input->coordinateData.x != 0 || Input->coordinateData.y != 0)
+		{
+			return true;
+		}
+
+		if (Input->jsonData == nullptr)
+		{
+			return false;
+		}
+
+		const char* End = Input->jsonData + Input->jsonDataLength;
+		const char* InputKey = FindJsonKey(Input->jsonData, End, "\"input\"", 7);
+		return InputKey != nullptr
+			&& FindJsonKey(InputKey, End, "\"x\"", 3) != nullptr
+			&& FindJsonKey(InputKey, End, "\"y\"", 3) != nullptr;
+	}
+
 	bool GetControlPropertyHelper(interactive_session Session, const char* ControlName, const char *PropertyName, FString& Result)
 	{
 		size_t RequiredSize = 0;
@@ -196,6 +240,34 @@ void FMixerInteractivityModule_InteractiveCpp2::CallRemoteMethod(const FString&
 	}
 }
 
+bool FMixerInteractivityModule_InteractiveCpp2::SetBandwidthThrottle(EMixerInteractivityThrottle ThrottleType, uint32 MaxBytes, uint32 BytesPerSecond)
+{
+	if (InteractiveSession == nullptr)
+	{
+		return false;
+	}
+
+	interactive_throttle_type NativeThrottleType;
+	switch (ThrottleType)
+	{
+	case EMixerInteractivityThrottle::Input:
+		NativeThrottleType = throttle_input;
+		break;
+	case EMixerInteractivityThrottle::ParticipantJoin:
+		NativeThrottleType = throttle_participant_join;
+		break;
+	case EMixerInteractivityThrottle::ParticipantLeave:
+		NativeThrottleType = throttle_participant_leave;
+		break;
+	case EMixerInteractivityThrottle::Global:
+	default:
+		NativeThrottleType = throttle_global;
+		break;
+	}
+
+	return interactive_set_bandwidth_throttle(InteractiveSession, NativeThrottleType, MaxBytes, BytesPerSecond) == MIXER_OK;
+}
+
 bool FMixerInteractivityModule_InteractiveCpp2::StartInteractiveConnection()
 {
 	if (GetInteractiveConnectionAuthState() != EMixerLoginState::Not_Logged_In)
@@ -244,13 +316,77 @@ void FMixerInteractivityModule_InteractiveCpp2::StopInteractiveConnection()
 	}
 }
 
+bool FMixerInteractivityModule_InteractiveCpp2::SendParticipantSyncPageRequest(const FString& MethodName, const TSharedRef<FJsonObject> Params)
+{
+	if (InteractiveSession == nullptr)
+	{
+		return false;
+	}
+
+	FString SerializedParams;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&SerializedParams, 0);
+	FJsonSerializer::Serialize(Params, Writer);
+
+	bParticipantSyncErrorLogged = false;
+	return interactive_send_method(InteractiveSession, TCHAR_TO_UTF8(*MethodName), TCHAR_TO_UTF8(*SerializedParams), false, &ParticipantSyncMessageId) == MIXER_OK;
+}
+
+void FMixerInteractivityModule_InteractiveCpp2::PollParticipantSyncReply()
+{
+	// interactive_run discards replies that nobody is blocked waiting on, so pick ours up first.
+	// One that lands between here and interactive_run is lost, and the page is re-requested after a timeout.
+	size_t ReplyLength = 0;
+	int32 Result = interactive_receive_reply(InteractiveSession, ParticipantSyncMessageId, 0, nullptr, &ReplyLength);
+	if (Result == MIXER_ERROR_TIMED_OUT)
+	{
+		return;
+	}
+
+	TArray<char> ReplyBuffer;
+	if (Result == MIXER_ERROR_BUFFER_SIZE)
+	{
+		ReplyBuffer.SetNumUninitialized(static_cast<int32>(ReplyLength));
+		Result = interactive_receive_reply(InteractiveSession, ParticipantSyncMessageId, 0, ReplyBuffer.GetData(), &ReplyLength);
+	}
+
+	if (Result != MIXER_OK)
+	{
+		// We keep polling until the page times out and is re-requested, so only report each request once
+		if (!bParticipantSyncErrorLogged)
+		{
+			UE_LOG(LogMixerInteractivity, Warning, TEXT("Participant sync page request failed with error %d"), Result);
+			bParticipantSyncErrorLogged = true;
+		}
+		return;
+	}
+
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(FString(UTF8_TO_TCHAR(ReplyBuffer.GetData())));
+	TSharedPtr<FJsonObject> JsonObject;
+	if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid())
+	{
+		const TSharedPtr<FJsonObject> *ResultObject;
+		if (JsonObject->TryGetObjectField(MixerStringConstants::FieldNames::Result, ResultObject))
+		{
+			HandleParticipantSyncPage(ResultObject->Get());
+		}
+	}
+}
+
 bool FMixerInteractivityModule_InteractiveCpp2::Tick(float DeltaTime)
 {
 	FMixerInteractivityModule_WithSessionState::Tick(DeltaTime);
 
 	if (InteractiveSession != nullptr)
 	{
+		if (IsAwaitingParticipantSyncPage())
+		{
+			PollParticipantSyncReply();
+		}
+
 		interactive_run(InteractiveSession, 10);
+
+		// Participant callbacks arrive one at a time - deliver whatever this run produced as a batch
+		FlushParticipantStateChanges();
 	}
 	else if (ConnectOperation.IsReady())
 	{
@@ -273,6 +409,7 @@ bool FMixerInteractivityModule_InteractiveCpp2::Tick(float DeltaTime)
 			interactive_get_scenes(InteractiveSession, &FMixerInteractivityModule_InteractiveCpp2::OnEnumerateScenesForInit);
 
 			SetInteractiveConnectionAuthState(EMixerLoginState::Logged_In);
+			BeginParticipantSync();
 		}
 		else
 		{
@@ -300,6 +437,7 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionStateChanged(void* Cont
 	default:
 		InteractiveModule.SetInteractivityState(EMixerInteractivityState::Not_Interactive);
 		InteractiveModule.SetInteractiveConnectionAuthState(EMixerLoginState::Not_Logged_In);
+		InteractiveModule.CancelParticipantSync();
 		break;
 	}
 }
@@ -313,15 +451,13 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionInput(void* Context, in
 {
 	FMixerInteractivityModule_InteractiveCpp2& InteractiveModule = static_cast<FMixerInteractivityModule_InteractiveCpp2&>(IMixerInteractivityModule::Get());
 
-	FGuid ParticipantGuid;
-	if (!FGuid::Parse(Input->participantId, ParticipantGuid))
+	const double DispatchStartTime = FPlatformTime::Seconds();
+	TSharedPtr<FMixerRemoteUser> ButtonUser = InteractiveModule.GetCachedUser(Input->participantId, static_cast<int32>(Input->participantIdLength));
+	if (!ButtonUser.IsValid())
 	{
-		UE_LOG(LogMixerInteractivity, Error, TEXT("Participant id %hs was not in the expected format (guid)"), Input->participantId);
 		return;
 	}
 
-	TSharedPtr<FMixerRemoteUser> ButtonUser = InteractiveModule.GetCachedUser(ParticipantGuid);
-
 	switch (Input->type)
 	{
 	case input_type_click:
@@ -337,19 +473,36 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionInput(void* Context, in
 		InteractiveModule.OnSessionCustomInput(ButtonUser, Input);
 		break;
 	}
+
+	InteractiveModule.RecordInputDispatch(DispatchStartTime);
 }
 
 void FMixerInteractivityModule_InteractiveCpp2::OnSessionButtonInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input)
 {
-	FMixerButtonPropertiesCached* CachedProps = GetButton(FName(Input->control.id));
-	if (CachedProps != nullptr)
+	const FMixerControlTableEntry* Control = FindControl(Input->control.id);
+	if (Control != nullptr && Control->Kind == EMixerControlKind::Button)
 	{
+		FName ControlId = Control->ControlId;
+		FMixerButtonPropertiesCached* CachedProps = Control->Button;
 		FMixerButtonEventDetails ButtonEventDetails;
 		ButtonEventDetails.Pressed = Input->buttonData.action == interactive_button_action_down;
 		ButtonEventDetails.TransactionId = Input->transactionId;
 		ButtonEventDetails.SparkCost = CachedProps->Desc.SparkCost;
+		ButtonEventDetails.bHasCoordinates = InputHasClickCoordinates(Input);
+		if (ButtonEventDetails.bHasCoordinates)
+		{
+			ButtonEventDetails.Coordinates = FVector2D(Input->coordinateData.x, Input->coordinateData.y);
+		}
 		if (ButtonEventDetails.Pressed)
 		{
+			if (ButtonEventDetails.bHasCoordinates)
+			{
+				RecordHeatMapClick(ControlId, ButtonEventDetails.Coordinates);
+			}
+			if (User.IsValid())
+			{
+				RecordButtonVote(ControlId, *User);
+			}
 			CachedProps->State.DownCount += 1;
 			if (CachePerParticipantState())
 			{
@@ -366,49 +519,26 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionButtonInput(TSharedPtr<
 				CachedProps->State.PressCount = CachedProps->HoldingParticipants.Num();
 			}
 		}
+		MarkButtonFrameCountersDirty(ControlId, *CachedProps);
 
-		OnButtonEvent().Broadcast(Input->control.id, User, ButtonEventDetails);
+		OnButtonEvent().Broadcast(ControlId, User, ButtonEventDetails);
 	}
 }
 
 void FMixerInteractivityModule_InteractiveCpp2::OnSessionCoordinateInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input)
 {
+	const FMixerControlTableEntry* Control = FindControl(Input->control.id);
+	FName ControlId = Control != nullptr ? Control->ControlId : FName(Input->control.id);
 	if (CachePerParticipantState())
 	{
-		FMixerStickPropertiesCached* CachedProps = GetStick(FName(Input->control.id));
-		if (CachedProps != nullptr)
+		FMixerStickPropertiesCached* CachedProps = Control != nullptr ? Control->Stick : nullptr;
+		if (CachedProps != nullptr && User.IsValid())
 		{
-			if (Input->coordinateData.x != 0 || Input->coordinateData.y != 0)
-			{
-				CachedProps->State.Axes *= CachedProps->PerParticipantStickValue.Num();
-				FVector2D& PerUserStickValue = CachedProps->PerParticipantStickValue.FindOrAdd(User->Id);
-				CachedProps->State.Axes -= PerUserStickValue;
-				PerUserStickValue = FVector2D(Input->coordinateData.x, Input->coordinateData.y);
-				CachedProps->State.Axes += PerUserStickValue;
-				CachedProps->State.Axes /= CachedProps->PerParticipantStickValue.Num();
-			}
-			else
-			{
-				FVector2D* OldPerUserStickValue = CachedProps->PerParticipantStickValue.Find(User->Id);
-				if (OldPerUserStickValue != nullptr)
-				{
-					CachedProps->State.Axes *= CachedProps->PerParticipantStickValue.Num();
-					CachedProps->State.Axes -= *OldPerUserStickValue;
-					CachedProps->PerParticipantStickValue.Remove(User->Id);
-					if (CachedProps->PerParticipantStickValue.Num() > 0)
-					{
-						CachedProps->State.Axes /= CachedProps->PerParticipantStickValue.Num();
-					}
-					else
-					{
-						CachedProps->State.Axes = FVector2D(0, 0);
-					}
-				}
-			}
+			UpdateStickParticipantValue(*CachedProps, *User, FVector2D(Input->coordinateData.x, Input->coordinateData.y));
 		}
 	}
 
-	OnStickEvent().Broadcast(Input->control.id, User, FVector2D(Input->coordinateData.x, Input->coordinateData.y));
+	OnStickEvent().Broadcast(ControlId, User, FVector2D(Input->coordinateData.x, Input->coordinateData.y));
 }
 
 bool FMixerInteractivityModule_InteractiveCpp2::OnSessionCustomInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input)
@@ -429,11 +559,12 @@ bool FMixerInteractivityModule_InteractiveCpp2::OnSessionCustomInput(TSharedPtr<
 	GET_JSON_STRING_RETURN_FAILURE(ControlId, ControlIdRaw);
 	GET_JSON_STRING_RETURN_FAILURE(Event, EventType);
 
-	FName ControlId = *ControlIdRaw;
+	const FMixerControlTableEntry* Control = FindControl(*ControlIdRaw);
+	FName ControlId = Control != nullptr ? Control->ControlId : FName(*ControlIdRaw);
 	bool bHandled = false;
-	if (EventType == MixerStringConstants::EventTypes::Submit)
+	if (ParseInputEventType(*EventType, EventType.Len()) == EMixerInputEventType::Submit)
 	{
-		FMixerTextboxPropertiesCached* Textbox = GetTextbox(ControlId);
+		FMixerTextboxPropertiesCached* Textbox = Control != nullptr ? Control->Textbox : nullptr;
 		if (Textbox != nullptr)
 		{
 			GET_JSON_STRING_RETURN_FAILURE(Value, Value);
@@ -459,6 +590,11 @@ bool FMixerInteractivityModule_InteractiveCpp2::OnSessionCustomInput(TSharedPtr<
 
 	if (!bHandled)
 	{
+		FVector2D Position;
+		if (Control != nullptr && Control->Kind == EMixerControlKind::Custom && GetInputCoordinates(JsonObj, Position))
+		{
+			RecordHeatMapClick(ControlId, Position);
+		}
 		OnCustomControlInput().Broadcast(ControlId, *EventType, User, InputObj->ToSharedRef());
 	}
 
@@ -480,7 +616,15 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionParticipantsChanged(voi
 	{
 	case participant_join:
 		{
-			TSharedPtr<FMixerRemoteUser> CachedParticipant = MakeShared<FMixerRemoteUser>();
+			// The connect-time participant sync may already have added (and announced) this participant
+			TSharedPtr<FMixerRemoteUser> CachedParticipant = InteractiveModule.GetCachedUser(SessionGuid);
+			const bool bAlreadyKnown = CachedParticipant.IsValid();
+			const bool bOldInputEnabled = bAlreadyKnown && CachedParticipant->InputEnabled;
+			if (!bAlreadyKnown)
+			{
+				CachedParticipant = InteractiveModule.AllocateUser();
+			}
+
 			CachedParticipant->Id = Participant->userId;
 			CachedParticipant->SessionGuid = SessionGuid;
 			CachedParticipant->Name = UTF8_TO_TCHAR(Participant->userName);
@@ -491,12 +635,27 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionParticipantsChanged(voi
 			CachedParticipant->ConnectedAt = FDateTime::FromUnixTimestamp(static_cast<int64>(Participant->connectedAtMs / 1000.0));
 			CachedParticipant->InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(Participant->lastInputAtMs / 1000.0));
 
-			InteractiveModule.AddUser(CachedParticipant);
+			if (!bAlreadyKnown)
+			{
+				InteractiveModule.AddUser(CachedParticipant);
+				InteractiveModule.QueueParticipantStateChange(CachedParticipant, EMixerInteractivityParticipantState::Joined);
+			}
+			else if (bOldInputEnabled != CachedParticipant->InputEnabled)
+			{
+				InteractiveModule.QueueParticipantStateChange(CachedParticipant, EMixerInteractivityParticipantState::Input_Disabled);
+			}
 		}
 		break;
 
 	case participant_leave:
-		InteractiveModule.RemoveUser(SessionGuid);
+		{
+			TSharedPtr<FMixerRemoteUser> CachedParticipant = InteractiveModule.GetCachedUser(SessionGuid);
+			if (CachedParticipant.IsValid())
+			{
+				InteractiveModule.RemoveUser(CachedParticipant);
+				InteractiveModule.QueueParticipantStateChange(CachedParticipant, EMixerInteractivityParticipantState::Left);
+			}
+		}
 		break;
 
 	case participant_update:
@@ -508,7 +667,12 @@ void FMixerInteractivityModule_InteractiveCpp2::OnSessionParticipantsChanged(voi
 			CachedParticipant->Level = Participant->level;
 			CachedParticipant->Group = Participant->groupId;
 			CachedParticipant->InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(Participant->lastInputAtMs / 1000.0));
+			const bool bOldInputEnabled = CachedParticipant->InputEnabled;
 			CachedParticipant->InputEnabled = !Participant->disabled;
+			if (bOldInputEnabled != CachedParticipant->InputEnabled)
+			{
+				InteractiveModule.QueueParticipantStateChange(CachedParticipant, EMixerInteractivityParticipantState::Input_Disabled);
+			}
 	}
 		break;
 
@@ -531,10 +695,32 @@ void FMixerInteractivityModule_InteractiveCpp2::OnUnhandledMethod(void* Context,
 			const TSharedPtr<FJsonObject> *ParamsObject;
 			if (JsonObject->TryGetObjectField(TEXT("params"), ParamsObject))
 			{
+				// The SDK has no handlers for scene and control changes pushed by the service,
+				// so apply them to the cached controls incrementally here.
 				if (Method == TEXT("onControlUpdate"))
 				{
 					InteractiveModule.HandleControlUpdateMessage(ParamsObject->Get());
 				}
+				else if (Method == MixerStringConstants::MethodNames::OnControlCreate)
+				{
+					InteractiveModule.HandleControlCreateMessage(ParamsObject->Get());
+				}
+				else if (Method == MixerStringConstants::MethodNames::OnControlDelete)
+				{
+					InteractiveModule.HandleControlDeleteMessage(ParamsObject->Get());
+				}
+				else if (Method == MixerStringConstants::MethodNames::OnSceneCreate)
+				{
+					InteractiveModule.HandleSceneCreateMessage(ParamsObject->Get());
+				}
+				else if (Method == MixerStringConstants::MethodNames::OnSceneUpdate)
+				{
+					InteractiveModule.HandleSceneUpdateMessage(ParamsObject->Get());
+				}
+				else if (Method == MixerStringConstants::MethodNames::OnSceneDelete)
+				{
+					InteractiveModule.HandleSceneDeleteMessage(ParamsObject->Get());
+				}
 				else
 				{
 					InteractiveModule.OnCustomMethodCall().Broadcast(*Method, ParamsObject->ToSharedRef());
@@ -596,6 +782,7 @@ void FMixerInteractivityModule_InteractiveCpp2::OnEnumerateControlsForInit(void*
 	{
 		FMixerStickPropertiesCached CachedProps;
 		CachedProps.State.Enabled = true;
+		CachedProps.SceneId = Scene->id;
 
 		InteractiveModule.AddStick(FName(Control->id), CachedProps);
 	}
@@ -620,9 +807,14 @@ void FMixerInteractivityModule_InteractiveCpp2::OnEnumerateControlsForInit(void*
 		GetControlPropertyHelper(Session, Control->id, "hasSubmit", Textbox.Desc.HasSubmit);
 		GetControlPropertyHelper(Session, Control->id, "multiline", Textbox.Desc.Multiline);
 		GetControlPropertyHelper(Session, Control->id, "submitText", Textbox.Desc.SubmitText);
+		Textbox.SceneId = Scene->id;
 
 		InteractiveModule.AddTextbox(FName(Control->id), Textbox);
 	}
+	else
+	{
+		InteractiveModule.AddCustomControl(FName(Control->id), Scene->id);
+	}
 }
 
 #endif
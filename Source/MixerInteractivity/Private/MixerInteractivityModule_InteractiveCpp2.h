@@ -29,6 +29,7 @@ public:
 	virtual bool MoveParticipantToGroup(FName GroupName, uint32 ParticipantId);
 	virtual void CaptureSparkTransaction(const FString& TransactionId);
 	virtual void CallRemoteMethod(const FString& MethodName, const TSharedRef<FJsonObject> MethodParams);
+	virtual bool SetBandwidthThrottle(EMixerInteractivityThrottle ThrottleType, uint32 MaxBytes, uint32 BytesPerSecond);
 
 public:
 	virtual bool Tick(float DeltaTime) override;
@@ -36,6 +37,7 @@ public:
 protected:
 	virtual bool StartInteractiveConnection();
 	virtual void StopInteractiveConnection();
+	virtual bool SendParticipantSyncPageRequest(const FString& MethodName, const TSharedRef<FJsonObject> Params);
 
 private:
 
@@ -50,6 +52,8 @@ private:
 	void OnSessionCoordinateInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input);
 	bool OnSessionCustomInput(TSharedPtr<const FMixerRemoteUser> User, const interactive_input* Input);
 
+	void PollParticipantSyncReply();
+
 	struct FGetCurrentSceneEnumContext
 	{
 		FName GroupName;
@@ -63,6 +67,8 @@ private:
 
 	interactive_session InteractiveSession;
 	TFuture<interactive_session> ConnectOperation;
+	uint32 ParticipantSyncMessageId;
+	bool bParticipantSyncErrorLogged;
 };
 
 #endif
\ No newline at end of file
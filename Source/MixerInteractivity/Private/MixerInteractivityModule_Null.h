@@ -21,12 +21,19 @@ public:
 	virtual void SetCurrentScene(FName Scene, FName GroupName = NAME_None) {}
 	virtual FName GetCurrentScene(FName GroupName = NAME_None) { return NAME_None; }
 	virtual void TriggerButtonCooldown(FName Button, FTimespan CooldownTime) {}
+	virtual bool StartVoteTally(FName TallyName, const TArray<FName>& Options, FTimespan Window, bool bSlidingWindow, bool bUniqueVoters) { return false; }
+	virtual void StopVoteTally(FName TallyName) {}
+	virtual bool GetVoteTally(FName TallyName, FName GroupName, bool bLastCompletedWindow, TArray<int32>& OutCounts) { return false; }
+	virtual bool StartHeatMap(FName Control, int32 Width, int32 Height, const FBox2D& Bounds, FTimespan HalfLife) { return false; }
+	virtual void StopHeatMap(FName Control) {}
+	virtual bool GetHeatMap(FName Control, int32& OutWidth, int32& OutHeight, TArrayView<const float>& OutValues, float& OutMaxValue) { return false; }
 	virtual bool GetButtonDescription(FName Button, FMixerButtonDescription& OutDesc) { return false; }
 	virtual bool GetButtonState(FName Button, FMixerButtonState& OutState) { return false; }
 	virtual bool GetButtonState(FName Button, uint32 ParticipantId, FMixerButtonState& OutState) { return false; }
 	virtual bool GetStickDescription(FName Stick, FMixerStickDescription& OutDesc) { return false; }
 	virtual bool GetStickState(FName Stick, FMixerStickState& OutState) { return false; }
 	virtual bool GetStickState(FName Stick, uint32 ParticipantId, FMixerStickState& OutState) { return false; }
+	virtual bool GetStickStatistics(FName Stick, int32 DirectionBuckets, float Percentile, FMixerStickStatistics& OutStats) { return false; }
 	virtual void SetLabelText(FName Label, const FText& DisplayText) {}
 	virtual bool GetLabelDescription(FName Label, FMixerLabelDescription& OutDesc) { return false; }
 	virtual bool GetTextboxDescription(FName Textbox, FMixerTextboxDescription& OutDesc) { return false; }
@@ -36,6 +43,7 @@ public:
 	virtual bool MoveParticipantToGroup(FName GroupName, uint32 ParticipantId) { return false; }
 	virtual void CaptureSparkTransaction(const FString& TransactionId) {}
 	virtual void CallRemoteMethod(const FString& MethodName, const TSharedRef<FJsonObject> MethodParams) {}
+	virtual bool SetBandwidthThrottle(EMixerInteractivityThrottle ThrottleType, uint32 MaxBytes, uint32 BytesPerSecond) { return false; }
 
 protected:
 	virtual bool StartInteractiveConnection() { return false; }
@@ -95,6 +95,7 @@ public:
 
 FMixerInteractivityModule_UE::FMixerInteractivityModule_UE()
 	: TMixerWebSocketOwnerBase<FMixerInteractivityModule_UE>(MixerStringConstants::MessageTypes::Method, MixerStringConstants::FieldNames::Method, MixerStringConstants::FieldNames::Params)
+	, ParticipantSyncMessageId(-1)
 {
 }
 
@@ -201,6 +202,40 @@ void FMixerInteractivityModule_UE::CallRemoteMethod(const FString& MethodName, c
 	SendMethodMessageObjectParams(MethodName, nullptr, MethodParams);
 }
 
+bool FMixerInteractivityModule_UE::SetBandwidthThrottle(EMixerInteractivityThrottle ThrottleType, uint32 MaxBytes, uint32 BytesPerSecond)
+{
+	if (GetInteractiveConnectionAuthState() != EMixerLoginState::Logged_In)
+	{
+		return false;
+	}
+
+	const FString* ThrottledMethod = nullptr;
+	switch (ThrottleType)
+	{
+	case EMixerInteractivityThrottle::Input:
+		ThrottledMethod = &MixerStringConstants::MethodNames::GiveInput;
+		break;
+	case EMixerInteractivityThrottle::ParticipantJoin:
+		ThrottledMethod = &MixerStringConstants::MethodNames::OnParticipantJoin;
+		break;
+	case EMixerInteractivityThrottle::ParticipantLeave:
+		ThrottledMethod = &MixerStringConstants::MethodNames::OnParticipantLeave;
+		break;
+	case EMixerInteractivityThrottle::Global:
+	default:
+		break;
+	}
+
+	TSharedRef<FJsonObject> ThrottleParams = MakeShared<FJsonObject>();
+	ThrottleParams->SetNumberField(MixerStringConstants::FieldNames::Capacity, MaxBytes);
+	ThrottleParams->SetNumberField(MixerStringConstants::FieldNames::DrainRate, BytesPerSecond);
+
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetObjectField(ThrottledMethod != nullptr ? *ThrottledMethod : TEXT("*"), ThrottleParams);
+	SendMethodMessageObjectParams(MixerStringConstants::MethodNames::SetBandwidthThrottle, nullptr, Params);
+	return true;
+}
+
 bool FMixerInteractivityModule_UE::StartInteractiveConnection()
 {
 	if (GetInteractiveConnectionAuthState() != EMixerLoginState::Not_Logged_In)
@@ -236,6 +271,18 @@ void FMixerInteractivityModule_UE::StopInteractiveConnection()
 	}
 }
 
+bool FMixerInteractivityModule_UE::SendParticipantSyncPageRequest(const FString& MethodName, const TSharedRef<FJsonObject> Params)
+{
+	if (GetInteractiveConnectionAuthState() != EMixerLoginState::Logged_In)
+	{
+		return false;
+	}
+
+	ParticipantSyncMessageId = GetNextMessageId();
+	SendMethodMessageObjectParams(MethodName, &FMixerInteractivityModule_UE::HandleParticipantSyncReply, Params);
+	return true;
+}
+
 void FMixerInteractivityModule_UE::OnHostsRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded)
 {
 	if (bSucceeded && HttpResponse.IsValid())
@@ -327,6 +374,9 @@ void FMixerInteractivityModule_UE::HandleSocketConnectionError()
 
 void FMixerInteractivityModule_UE::HandleSocketClosed( bool bWasClean)
 {
+	// Pages requested on the old socket will never be answered
+	CancelParticipantSync();
+
 	// Attempt to reconnect
 	OpenWebSocket();
 }
@@ -334,12 +384,17 @@ void FMixerInteractivityModule_UE::HandleSocketClosed( bool bWasClean)
 void FMixerInteractivityModule_UE::RegisterAllServerMessageHandlers()
 {
 	RegisterServerMessageHandler(TEXT("hello"), &FMixerInteractivityModule_UE::HandleHello);
-	RegisterServerMessageHandler(TEXT("giveInput"), &FMixerInteractivityModule_UE::HandleGiveInput);
-	RegisterServerMessageHandler(TEXT("onParticipantJoin"), &FMixerInteractivityModule_UE::HandleParticipantJoin);
-	RegisterServerMessageHandler(TEXT("onParticipantLeave"), &FMixerInteractivityModule_UE::HandleParticipantLeave);
+	RegisterServerMessageHandler(MixerStringConstants::MethodNames::GiveInput, &FMixerInteractivityModule_UE::HandleGiveInput);
+	RegisterServerMessageHandler(MixerStringConstants::MethodNames::OnParticipantJoin, &FMixerInteractivityModule_UE::HandleParticipantJoin);
+	RegisterServerMessageHandler(MixerStringConstants::MethodNames::OnParticipantLeave, &FMixerInteractivityModule_UE::HandleParticipantLeave);
 	RegisterServerMessageHandler(TEXT("onParticipantUpdate"), &FMixerInteractivityModule_UE::HandleParticipantUpdate);
 	RegisterServerMessageHandler(TEXT("onReady"), &FMixerInteractivityModule_UE::HandleReadyStateChange);
 	RegisterServerMessageHandler(TEXT("onControlUpdate"), &FMixerInteractivityModule_UE::HandleControlUpdateMessage);
+	RegisterServerMessageHandler(MixerStringConstants::MethodNames::OnControlCreate, &FMixerInteractivityModule_UE::HandleControlCreateMessage);
+	RegisterServerMessageHandler(MixerStringConstants::MethodNames::OnControlDelete, &FMixerInteractivityModule_UE::HandleControlDeleteMessage);
+	RegisterServerMessageHandler(MixerStringConstants::MethodNames::OnSceneCreate, &FMixerInteractivityModule_UE::HandleSceneCreateMessage);
+	RegisterServerMessageHandler(MixerStringConstants::MethodNames::OnSceneUpdate, &FMixerInteractivityModule_UE::HandleSceneUpdateMessage);
+	RegisterServerMessageHandler(MixerStringConstants::MethodNames::OnSceneDelete, &FMixerInteractivityModule_UE::HandleSceneDelete);
 	RegisterServerMessageHandler(TEXT("onGroupCreate"), &FMixerInteractivityModule_UE::HandleGroupCreate);
 	RegisterServerMessageHandler(TEXT("onGroupUpdate"), &FMixerInteractivityModule_UE::HandleGroupUpdate);
 	RegisterServerMessageHandler(TEXT("onGroupDelete"), &FMixerInteractivityModule_UE::HandleGroupDelete);
@@ -360,18 +415,18 @@ bool FMixerInteractivityModule_UE::HandleHello(FJsonObject* JsonObj)
 bool FMixerInteractivityModule_UE::HandleGiveInput(FJsonObject* JsonObj)
 {
 	GET_JSON_STRING_RETURN_FAILURE(ParticipantId, ParticipantGuidString);
+	GET_JSON_OBJECT_RETURN_FAILURE(Input, InputObj);
 
-	FGuid ParticipantGuid;
-	if (!FGuid::Parse(ParticipantGuidString, ParticipantGuid))
+	const double DispatchStartTime = FPlatformTime::Seconds();
+	TSharedPtr<FMixerRemoteUser> RemoteUser = GetCachedUser(*ParticipantGuidString, ParticipantGuidString.Len());
+	if (!RemoteUser.IsValid())
 	{
-		UE_LOG(LogMixerInteractivity, Error, TEXT("%s field %s for input event was not in the expected format (guid)"), *MixerStringConstants::FieldNames::ParticipantId, *ParticipantGuidString);
 		return false;
 	}
 
-	GET_JSON_OBJECT_RETURN_FAILURE(Input, InputObj);
-
-	TSharedPtr<FMixerRemoteUser> RemoteUser = GetCachedUser(ParticipantGuid);
-	return HandleGiveInput(RemoteUser, JsonObj, InputObj->ToSharedRef());
+	bool bHandled = HandleGiveInput(RemoteUser, JsonObj, InputObj->ToSharedRef());
+	RecordInputDispatch(DispatchStartTime);
+	return bHandled;
 }
 
 bool FMixerInteractivityModule_UE::HandleParticipantJoin(FJsonObject* JsonObj)
@@ -448,14 +503,50 @@ bool FMixerInteractivityModule_UE::HandleGroupDelete(FJsonObject* JsonObj)
 	return true;
 }
 
+bool FMixerInteractivityModule_UE::HandleSceneDelete(FJsonObject* JsonObj)
+{
+	GET_JSON_STRING_RETURN_FAILURE(SceneId, SceneIdRaw);
+	GET_JSON_STRING_RETURN_FAILURE(ReassignSceneId, ReassignSceneIdRaw);
+
+	FName SceneId = *SceneIdRaw;
+	FName ReassignSceneId = *ReassignSceneIdRaw;
+
+	// Groups showing the deleted scene are moved to its replacement by the service
+	for (TMap<FName, FName>::TIterator It(ScenesByGroup); It; ++It)
+	{
+		if (It->Value == SceneId)
+		{
+			It->Value = ReassignSceneId;
+		}
+	}
+
+	return HandleSceneDeleteMessage(JsonObj);
+}
+
 bool FMixerInteractivityModule_UE::HandleGetScenesReply(FJsonObject* JsonObj)
 {
 	SetInteractiveConnectionAuthState(EMixerLoginState::Logged_In);
 	GET_JSON_OBJECT_RETURN_FAILURE(Result, Result);
 	ParsePropertiesFromGetScenesResult(Result->Get());
+	BeginParticipantSync();
 	return true;
 }
 
+bool FMixerInteractivityModule_UE::HandleParticipantSyncReply(FJsonObject* JsonObj)
+{
+	// A late reply to a request that timed out and was re-sent describes a stale cursor
+	GET_JSON_INT_RETURN_FAILURE(Id, ReplyingToMessageId);
+	if (ReplyingToMessageId != ParticipantSyncMessageId)
+	{
+		UE_LOG(LogMixerInteractivity, Verbose, TEXT("Ignoring superseded participant sync reply %d"), ReplyingToMessageId);
+		return true;
+	}
+
+	// An error reply leaves the page outstanding, so it will be retried
+	GET_JSON_OBJECT_RETURN_FAILURE(Result, Result);
+	return HandleParticipantSyncPage(Result->Get());
+}
+
 bool FMixerInteractivityModule_UE::HandleGiveInput(TSharedPtr<FMixerRemoteUser> Participant, FJsonObject* FullParamsJson, const TSharedRef<FJsonObject> InputObjJson)
 {
 	// Alias so macros work
@@ -465,81 +556,87 @@ bool FMixerInteractivityModule_UE::HandleGiveInput(TSharedPtr<FMixerRemoteUser>
 	GET_JSON_STRING_RETURN_FAILURE(Event, EventType);
 
 	bool bHandled = false;
-	FName ControlId = *ControlIdRaw;
-	if (EventType == MixerStringConstants::EventTypes::MouseDown)
-	{
-		FMixerButtonPropertiesCached* ButtonProps = GetButton(ControlId);
-		if (ButtonProps != nullptr)
+	const FMixerControlTableEntry* Control = FindControl(*ControlIdRaw);
+	FName ControlId = Control != nullptr ? Control->ControlId : FName(*ControlIdRaw);
+	EMixerInputEventType InputEventType = ParseInputEventType(*EventType, EventType.Len());
+	if (Control != nullptr && Control->Kind == EMixerControlKind::Button && InputEventType == EMixerInputEventType::MouseDown)
+	{
+		FMixerButtonEventDetails EventDetails;
+		EventDetails.Pressed = true;
+		if (Control->Button->Desc.SparkCost > 0)
 		{
-			FMixerButtonEventDetails EventDetails;
-			EventDetails.Pressed = true;
-			if (ButtonProps->Desc.SparkCost > 0)
-			{
-				FullParamsJson->TryGetStringField(MixerStringConstants::FieldNames::TransactionId, EventDetails.TransactionId);
-				EventDetails.SparkCost = ButtonProps->Desc.SparkCost;
-			}
-			else
-			{
-				EventDetails.SparkCost = 0;
-			}
-			OnButtonEvent().Broadcast(ControlId, Participant, EventDetails);
-			bHandled = true;
+			FullParamsJson->TryGetStringField(MixerStringConstants::FieldNames::TransactionId, EventDetails.TransactionId);
+			EventDetails.SparkCost = Control->Button->Desc.SparkCost;
 		}
-	}
-	else if (EventType == MixerStringConstants::EventTypes::MouseUp)
-	{
-		FMixerButtonPropertiesCached* ButtonProps = GetButton(ControlId);
-		if (ButtonProps != nullptr)
+		else
 		{
-			FMixerButtonEventDetails EventDetails;
-			EventDetails.Pressed = false;
-			// Button mouseup doesn't support charging
 			EventDetails.SparkCost = 0;
-
-			OnButtonEvent().Broadcast(ControlId, Participant, EventDetails);
-			bHandled = true;
 		}
+		EventDetails.bHasCoordinates = GetInputCoordinates(JsonObj, EventDetails.Coordinates);
+		if (EventDetails.bHasCoordinates)
+		{
+			RecordHeatMapClick(ControlId, EventDetails.Coordinates);
+		}
+		if (Participant.IsValid())
+		{
+			RecordButtonVote(ControlId, *Participant);
+		}
+		OnButtonEvent().Broadcast(ControlId, Participant, EventDetails);
+		bHandled = true;
 	}
-	else if (EventType == MixerStringConstants::EventTypes::Move)
+	else if (Control != nullptr && Control->Kind == EMixerControlKind::Button && InputEventType == EMixerInputEventType::MouseUp)
 	{
-		FMixerStickPropertiesCached* Stick = GetStick(ControlId);
-		if (Stick != nullptr)
-		{
-			GET_JSON_DOUBLE_RETURN_FAILURE(X, X);
-			GET_JSON_DOUBLE_RETURN_FAILURE(Y, Y);
+		FMixerButtonEventDetails EventDetails;
+		EventDetails.Pressed = false;
+		// Button mouseup doesn't support charging
+		EventDetails.SparkCost = 0;
+		EventDetails.bHasCoordinates = GetInputCoordinates(JsonObj, EventDetails.Coordinates);
 
-			OnStickEvent().Broadcast(ControlId, Participant, FVector2D(static_cast<float>(X), static_cast<float>(Y)));
-			bHandled = true;
-		}
+		OnButtonEvent().Broadcast(ControlId, Participant, EventDetails);
+		bHandled = true;
 	}
-	else if (EventType == MixerStringConstants::EventTypes::Submit)
+	else if (Control != nullptr && Control->Kind == EMixerControlKind::Stick && InputEventType == EMixerInputEventType::Move)
 	{
-		FMixerTextboxPropertiesCached* Textbox = GetTextbox(ControlId);
-		if (Textbox != nullptr)
+		GET_JSON_DOUBLE_RETURN_FAILURE(X, X);
+		GET_JSON_DOUBLE_RETURN_FAILURE(Y, Y);
+
+		if (CachePerParticipantState() && Participant.IsValid())
 		{
-			GET_JSON_STRING_RETURN_FAILURE(Value, Value);
+			UpdateStickParticipantValue(*Control->Stick, *Participant, FVector2D(static_cast<float>(X), static_cast<float>(Y)));
+		}
 
-			FMixerTextboxEventDetails EventDetails;
-			EventDetails.SubmittedText = FText::FromString(Value);
-			if (Textbox->Desc.SparkCost > 0)
-			{
-				if (FullParamsJson->TryGetStringField(MixerStringConstants::FieldNames::TransactionId, EventDetails.TransactionId))
-				{
-					EventDetails.SparkCost = Textbox->Desc.SparkCost;
-				}
-			}
-			else
+		OnStickEvent().Broadcast(ControlId, Participant, FVector2D(static_cast<float>(X), static_cast<float>(Y)));
+		bHandled = true;
+	}
+	else if (Control != nullptr && Control->Kind == EMixerControlKind::Textbox && InputEventType == EMixerInputEventType::Submit)
+	{
+		GET_JSON_STRING_RETURN_FAILURE(Value, Value);
+
+		FMixerTextboxEventDetails EventDetails;
+		EventDetails.SubmittedText = FText::FromString(Value);
+		if (Control->Textbox->Desc.SparkCost > 0)
+		{
+			if (FullParamsJson->TryGetStringField(MixerStringConstants::FieldNames::TransactionId, EventDetails.TransactionId))
 			{
-				EventDetails.SparkCost = 0;
+				EventDetails.SparkCost = Control->Textbox->Desc.SparkCost;
 			}
-
-			OnTextboxSubmitEvent().Broadcast(ControlId, Participant, EventDetails);
-			bHandled = true;
 		}
+		else
+		{
+			EventDetails.SparkCost = 0;
+		}
+
+		OnTextboxSubmitEvent().Broadcast(ControlId, Participant, EventDetails);
+		bHandled = true;
 	}
 
 	if (!bHandled)
 	{
+		FVector2D Position;
+		if (Control != nullptr && Control->Kind == EMixerControlKind::Custom && GetInputCoordinates(JsonObj, Position))
+		{
+			RecordHeatMapClick(ControlId, Position);
+		}
 		OnCustomControlInput().Broadcast(ControlId, *EventType, Participant, InputObjJson);
 	}
 
@@ -555,63 +652,9 @@ bool FMixerInteractivityModule_UE::HandleParticipantEvent(FJsonObject* JsonObj,
 	{
 		bHandled &= HandleSingleParticipantChange(Participant->AsObject().Get(), EventType);
 	}
-	return bHandled;
-}
-
-bool FMixerInteractivityModule_UE::HandleSingleParticipantChange(const FJsonObject* JsonObj, EMixerInteractivityParticipantState EventType)
-{
-	GET_JSON_STRING_RETURN_FAILURE(UserNameNoUnderscore, Username);
-	GET_JSON_INT_RETURN_FAILURE(UserIdNoUnderscore, UserId);
-	GET_JSON_INT_RETURN_FAILURE(Level, UserLevel);
-	GET_JSON_DOUBLE_RETURN_FAILURE(LastInputAt, LastInputAtDouble);
-	GET_JSON_DOUBLE_RETURN_FAILURE(ConnectedAt, ConnectedAtDouble);
-	GET_JSON_STRING_RETURN_FAILURE(GroupId, GroupId);
-	GET_JSON_STRING_RETURN_FAILURE(SessionId, SessionGuidString);
-
-	FGuid SessionGuid;
-	if (!FGuid::Parse(SessionGuidString, SessionGuid))
-	{
-		UE_LOG(LogMixerInteractivity, Error, TEXT("sessionID field %s for participant event was not in the expected format (guid)"), *SessionGuidString);
-		return false;
-	}
-
-	TSharedPtr<FMixerRemoteUser> RemoteUser = GetCachedUser(UserId);
-	bool bOldInputEnabled = false;
-	bool bExistingUser = false;
-	if (RemoteUser.IsValid())
-	{
-		bExistingUser = true;
-		bOldInputEnabled = RemoteUser->InputEnabled;
-	}
-	else
-	{
-		RemoteUser = MakeShared<FMixerRemoteUser>();
-		RemoteUser->Id = UserId;
-		RemoteUser->SessionGuid = SessionGuid;
-		RemoteUser->ConnectedAt = FDateTime::FromUnixTimestamp(static_cast<int64>(ConnectedAtDouble / 1000.0));
-
-		if (EventType != EMixerInteractivityParticipantState::Left)
-		{
-			AddUser(RemoteUser);
-		}
-	}
-
-	RemoteUser->Name = Username;
-	RemoteUser->Level = UserLevel;
-	RemoteUser->InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(LastInputAtDouble / 1000.0));
-	RemoteUser->Group = *GroupId;
-
-	if (EventType != EMixerInteractivityParticipantState::Input_Disabled || bOldInputEnabled != RemoteUser->InputEnabled)
-	{
-		OnParticipantStateChanged().Broadcast(RemoteUser, EventType);
-	}
-
-	if (bExistingUser && EventType == EMixerInteractivityParticipantState::Left)
-	{
-		RemoveUser(RemoteUser);
-	}
 
-	return true;
+	FlushParticipantStateChanges();
+	return bHandled;
 }
 
 bool FMixerInteractivityModule_UE::ParsePropertiesFromGetScenesResult(FJsonObject *JsonObj)
@@ -654,96 +697,6 @@ bool FMixerInteractivityModule_UE::ParsePropertiesFromSingleScene(FJsonObject* J
 	return true;
 }
 
-bool FMixerInteractivityModule_UE::ParsePropertiesFromSingleControl(FName SceneId, TSharedRef<FJsonObject> JsonObj)
-{
-	GET_JSON_STRING_RETURN_FAILURE(Kind, ControlKind);
-	GET_JSON_STRING_RETURN_FAILURE(ControlId, ControlId);
-
-	if (ControlKind == FMixerInteractiveControl::ButtonKind)
-	{
-		FMixerButtonPropertiesCached Button;
-		FString FieldValueScratch;
-		JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Text, FieldValueScratch);
-		Button.Desc.ButtonText = FText::FromString(FieldValueScratch);
-		JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Tooltip, FieldValueScratch);
-		Button.Desc.HelpText = FText::FromString(FieldValueScratch);
-		JsonObj->TryGetNumberField(MixerStringConstants::FieldNames::Cost, Button.Desc.SparkCost);
-
-		// Disabled and cooldown shouldn't be set initially
-
-		Button.State.DownCount = 0;
-		Button.State.UpCount = 0;
-		Button.State.PressCount = 0;
-		Button.State.Enabled = true;
-		Button.State.RemainingCooldown = FTimespan::Zero();
-		Button.State.Progress = 0.0f;
-		Button.SceneId = SceneId;
-
-		AddButton(*ControlId, Button);
-	}
-	else if (ControlKind == FMixerInteractiveControl::JoystickKind)
-	{
-		FMixerStickPropertiesCached Stick;
-		Stick.State.Enabled = true;
-		AddStick(*ControlId, Stick);
-	}
-	else if (ControlKind == FMixerInteractiveControl::LabelKind)
-	{
-		FMixerLabelPropertiesCached Label;
-		Label.Desc.TextSize = 0;
-		Label.Desc.Underline = false;
-		Label.Desc.Bold = false;
-		Label.Desc.Italic = false;
-
-		FString FieldValueScratch;
-		if (JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Text, FieldValueScratch))
-		{
-			Label.Desc.Text = FText::FromString(FieldValueScratch);
-		}
-
-		if (JsonObj->TryGetStringField(MixerStringConstants::FieldNames::TextColor, FieldValueScratch))
-		{
-			Label.Desc.TextColor = FColor::FromHex(FieldValueScratch);
-		}
-		else
-		{
-			Label.Desc.TextColor = FColor::White;
-		}
-
-		JsonObj->TryGetStringField(MixerStringConstants::FieldNames::TextSize, Label.Desc.TextSize);
-		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Underline, Label.Desc.Underline);
-		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Bold, Label.Desc.Bold);
-		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Italic, Label.Desc.Italic);
-
-		Label.SceneId = SceneId;
-		AddLabel(*ControlId, Label);
-	}
-	else if (ControlKind == FMixerInteractiveControl::TextboxKind)
-	{
-		FMixerTextboxPropertiesCached Textbox;
-		JsonObj->TryGetNumberField(MixerStringConstants::FieldNames::Cost, Textbox.Desc.SparkCost);
-		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Multiline, Textbox.Desc.Multiline);
-		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::HasSubmit, Textbox.Desc.HasSubmit);
-		FString FieldValueScratch;
-		if (JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Placeholder, FieldValueScratch))
-		{
-			Textbox.Desc.Placeholder = FText::FromString(FieldValueScratch);
-		}
-		if (JsonObj->TryGetStringField(MixerStringConstants::FieldNames::SubmitText, FieldValueScratch))
-		{
-			Textbox.Desc.SubmitText = FText::FromString(FieldValueScratch);
-		}
-		AddTextbox(*ControlId, Textbox);
-	}
-	else
-	{
-		OnCustomControlPropertyUpdate().Broadcast(*ControlId, JsonObj);
-	}
-
-	return true;
-}
-
-
 #endif
 
 // Suppress linker warning "warning LNK4221: no public symbols found; archive member will be inaccessible"
@@ -31,10 +31,12 @@ public:
 	virtual bool MoveParticipantToGroup(FName GroupName, uint32 ParticipantId);
 	virtual void CaptureSparkTransaction(const FString& TransactionId);
 	virtual void CallRemoteMethod(const FString& MethodName, const TSharedRef<FJsonObject> MethodParams);
+	virtual bool SetBandwidthThrottle(EMixerInteractivityThrottle ThrottleType, uint32 MaxBytes, uint32 BytesPerSecond);
 
 protected:
 	virtual bool StartInteractiveConnection();
 	virtual void StopInteractiveConnection();
+	virtual bool SendParticipantSyncPageRequest(const FString& MethodName, const TSharedRef<FJsonObject> Params);
 
 protected:
 	virtual void RegisterAllServerMessageHandlers();
@@ -60,20 +62,21 @@ private:
 	bool HandleGroupCreate(FJsonObject* JsonObj);
 	bool HandleGroupUpdate(FJsonObject* JsonObj);
 	bool HandleGroupDelete(FJsonObject* JsonObj);
+	bool HandleSceneDelete(FJsonObject* JsonObj);
 
 	bool HandleGetScenesReply(FJsonObject* JsonObj);
+	bool HandleParticipantSyncReply(FJsonObject* JsonObj);
 
 	bool HandleGiveInput(TSharedPtr<FMixerRemoteUser> Participant, FJsonObject* FullParamsJson, const TSharedRef<FJsonObject> InputObjJson);
 	bool HandleParticipantEvent(FJsonObject* JsonObj, EMixerInteractivityParticipantState EventType);
-	bool HandleSingleParticipantChange(const FJsonObject* JsonObj, EMixerInteractivityParticipantState EventType);
 
 	bool ParsePropertiesFromGetScenesResult(FJsonObject *JsonObj);
 	bool ParsePropertiesFromSingleScene(FJsonObject* JsonObj);
-	bool ParsePropertiesFromSingleControl(FName SceneId, TSharedRef<FJsonObject> JsonObj);
 
 private:
 	TArray<FString> Endpoints;
 	TMap<FName, FName> ScenesByGroup;
+	int32 ParticipantSyncMessageId;
 };
 
 #endif
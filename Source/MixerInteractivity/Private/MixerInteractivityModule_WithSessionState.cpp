@@ -11,6 +11,524 @@
 #include "MixerInteractivityModule_WithSessionState.h"
 #include "MixerJsonHelpers.h"
 #include "MixerInteractivityLog.h"
+#include "MixerInteractivitySettings.h"
+#include "MixerInteractivityJsonTypes.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	// Length of the window over which input load is measured before adjusting the throttle
+	const double AdaptiveThrottleWindowSeconds = 1.0;
+
+	// Upper bound on released participant records kept around for reuse by later joins
+	const int32 MaxPooledParticipants = 4096;
+
+	// How long to wait on a participant page before asking again, and how many times to ask.
+	// The interactive-cpp-v2 backend may miss replies (see SendParticipantSyncPageRequest) so this is not purely defensive.
+	const double ParticipantSyncPageTimeoutSeconds = 10.0;
+	const int32 MaxParticipantSyncPageRetries = 3;
+
+	// Resolution of sliding vote tally windows - votes expire in steps of 1/N of the window
+	const int32 VoteTallyBucketsPerWindow = 20;
+
+	// Once the hottest cell of a heat map decays below this it is cleared outright, rather than
+	// letting the whole grid drift into denormals
+	const float HeatMapClearThreshold = 1.0e-4f;
+
+	// Guard against grids too large to plausibly be intended for a texture
+	const int32 MaxHeatMapCells = 1024 * 1024;
+
+	FTimespan GetRemainingCooldown(const FMixerButtonPropertiesCached& Button)
+	{
+		const double RemainingSeconds = Button.CooldownEndTime - FPlatformTime::Seconds();
+		return RemainingSeconds > 0.0 ? FTimespan::FromSeconds(RemainingSeconds) : FTimespan::Zero();
+	}
+
+	// FNV-1a over case-folded code units.  Control ids are ASCII in practice, so the
+	// TCHAR and UTF-8 spellings of an id used by the different backends hash identically.
+	template <typename CharType>
+	uint32 HashControlId(const CharType* RawId)
+	{
+		uint32 Hash = 2166136261u;
+		for (; *RawId; ++RawId)
+		{
+			Hash = (Hash ^ static_cast<uint32>(TChar<CharType>::ToLower(*RawId))) * 16777619u;
+		}
+		return Hash;
+	}
+
+	// Case-insensitive to match the FName semantics previously used for control lookup
+	template <typename CharType>
+	bool EqualsIgnoreCase(const FString& Stored, const CharType* Raw)
+	{
+		const TCHAR* StoredChars = *Stored;
+		for (; *StoredChars && *Raw; ++StoredChars, ++Raw)
+		{
+			if (static_cast<uint32>(TChar<TCHAR>::ToLower(*StoredChars)) != static_cast<uint32>(TChar<CharType>::ToLower(*Raw)))
+			{
+				return false;
+			}
+		}
+		return *StoredChars == 0 && *Raw == 0;
+	}
+
+	FMixerSessionIdKey MakeSessionIdKey(const FGuid& SessionGuid)
+	{
+		// Matches the format the service uses for session ids on the wire
+		FString SessionIdString = SessionGuid.ToString(EGuidFormats::DigitsWithHyphens);
+		FMixerSessionIdKey Key;
+		verify(Key.Set(*SessionIdString, SessionIdString.Len()));
+		return Key;
+	}
+
+	template <typename CharType>
+	TSharedPtr<FMixerRemoteUser> FindBySessionId(const TMap<FMixerSessionIdKey, TSharedPtr<FMixerRemoteUser>>& Cache, const CharType* RawId, int32 Length, bool& bOutKeyValid)
+	{
+		FMixerSessionIdKey Key;
+		bOutKeyValid = Key.Set(RawId, Length);
+		if (!bOutKeyValid)
+		{
+			return nullptr;
+		}
+
+		const TSharedPtr<FMixerRemoteUser>* User = Cache.Find(Key);
+		return User != nullptr ? *User : nullptr;
+	}
+
+	template <typename CharType>
+	const FMixerControlTableEntry* FindInControlTable(const TArray<FMixerControlTableEntry>& ControlTable, const TMap<uint32, int32>& IndexByHash, const CharType* RawId)
+	{
+		const int32* FirstIndex = IndexByHash.Find(HashControlId(RawId));
+		for (int32 Index = FirstIndex != nullptr ? *FirstIndex : INDEX_NONE; Index != INDEX_NONE; Index = ControlTable[Index].NextWithSameHash)
+		{
+			if (EqualsIgnoreCase(ControlTable[Index].RawId, RawId))
+			{
+				return &ControlTable[Index];
+			}
+		}
+
+		return nullptr;
+	}
+
+	template <typename CharType>
+	EMixerInputEventType ParseInputEventTypeInternal(const CharType* EventType, int32 EventTypeLength)
+	{
+		// The built-in event types all have distinct lengths, so length alone
+		// selects the single candidate that needs to be verified.
+		switch (EventTypeLength)
+		{
+		case 9:
+			return EqualsIgnoreCase(MixerStringConstants::EventTypes::MouseDown, EventType) ? EMixerInputEventType::MouseDown : EMixerInputEventType::Other;
+		case 7:
+			return EqualsIgnoreCase(MixerStringConstants::EventTypes::MouseUp, EventType) ? EMixerInputEventType::MouseUp : EMixerInputEventType::Other;
+		case 4:
+			return EqualsIgnoreCase(MixerStringConstants::EventTypes::Move, EventType) ? EMixerInputEventType::Move : EMixerInputEventType::Other;
+		case 6:
+			return EqualsIgnoreCase(MixerStringConstants::EventTypes::Submit, EventType) ? EMixerInputEventType::Submit : EMixerInputEventType::Other;
+		default:
+			return EMixerInputEventType::Other;
+		}
+	}
+
+	struct FStickValueSums
+	{
+		double X;
+		double Y;
+		double XX;
+		double YY;
+		double WX;
+		double WY;
+		double W;
+	};
+
+	double HorizontalSum(VectorRegister Vec)
+	{
+		float Lanes[4];
+		VectorStore(Vec, Lanes);
+		return static_cast<double>(Lanes[0]) + Lanes[1] + Lanes[2] + Lanes[3];
+	}
+
+	// Single pass over the SoA stick values, four participants at a time
+	void SumStickValues(const FMixerStickParticipantValues& Values, FStickValueSums& OutSums)
+	{
+		const float* X = Values.X.GetData();
+		const float* Y = Values.Y.GetData();
+		const float* W = Values.Weights.GetData();
+		const int32 Num = Values.Num();
+
+		VectorRegister SumX = VectorZero();
+		VectorRegister SumY = VectorZero();
+		VectorRegister SumXX = VectorZero();
+		VectorRegister SumYY = VectorZero();
+		VectorRegister SumWX = VectorZero();
+		VectorRegister SumWY = VectorZero();
+		VectorRegister SumW = VectorZero();
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const VectorRegister VX = VectorLoad(X + i);
+			const VectorRegister VY = VectorLoad(Y + i);
+			const VectorRegister VW = VectorLoad(W + i);
+			SumX = VectorAdd(SumX, VX);
+			SumY = VectorAdd(SumY, VY);
+			SumXX = VectorMultiplyAdd(VX, VX, SumXX);
+			SumYY = VectorMultiplyAdd(VY, VY, SumYY);
+			SumWX = VectorMultiplyAdd(VW, VX, SumWX);
+			SumWY = VectorMultiplyAdd(VW, VY, SumWY);
+			SumW = VectorAdd(SumW, VW);
+		}
+
+		OutSums.X = HorizontalSum(SumX);
+		OutSums.Y = HorizontalSum(SumY);
+		OutSums.XX = HorizontalSum(SumXX);
+		OutSums.YY = HorizontalSum(SumYY);
+		OutSums.WX = HorizontalSum(SumWX);
+		OutSums.WY = HorizontalSum(SumWY);
+		OutSums.W = HorizontalSum(SumW);
+
+		for (; i < Num; ++i)
+		{
+			OutSums.X += X[i];
+			OutSums.Y += Y[i];
+			OutSums.XX += X[i] * X[i];
+			OutSums.YY += Y[i] * Y[i];
+			OutSums.WX += W[i] * X[i];
+			OutSums.WY += W[i] * Y[i];
+			OutSums.W += W[i];
+		}
+	}
+
+	void ComputeSquaredMagnitudes(const FMixerStickParticipantValues& Values, TArray<float>& OutSquaredMagnitudes)
+	{
+		const float* X = Values.X.GetData();
+		const float* Y = Values.Y.GetData();
+		const int32 Num = Values.Num();
+
+		OutSquaredMagnitudes.SetNumUninitialized(Num, false);
+		float* Out = OutSquaredMagnitudes.GetData();
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const VectorRegister VX = VectorLoad(X + i);
+			const VectorRegister VY = VectorLoad(Y + i);
+			VectorStore(VectorMultiplyAdd(VX, VX, VectorMultiply(VY, VY)), Out + i);
+		}
+
+		for (; i < Num; ++i)
+		{
+			Out[i] = X[i] * X[i] + Y[i] * Y[i];
+		}
+	}
+
+	void LogMalformedSessionId(const FString& ParticipantGuidString)
+	{
+		// Ids come from the service, so one bad id is likely to be followed by many more - don't flood the log
+		static bool bLogged = false;
+		if (!bLogged)
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Participant session id %s was not in the expected format (guid).  Input from participants with malformed ids will be ignored."), *ParticipantGuidString);
+			bLogged = true;
+		}
+	}
+}
+
+FMixerStickParticipantValues::FMixerStickParticipantValues()
+	: SumX(0.0)
+	, SumY(0.0)
+{
+}
+
+bool FMixerStickParticipantValues::Find(uint32 ParticipantId, FVector2D& OutValue) const
+{
+	const int32* Index = IndexByParticipant.Find(ParticipantId);
+	if (Index != nullptr)
+	{
+		OutValue = FVector2D(X[*Index], Y[*Index]);
+		return true;
+	}
+	return false;
+}
+
+void FMixerStickParticipantValues::Set(uint32 ParticipantId, FVector2D Value, float Weight)
+{
+	const int32* ExistingIndex = IndexByParticipant.Find(ParticipantId);
+	if (ExistingIndex != nullptr)
+	{
+		const int32 Index = *ExistingIndex;
+		SumX += Value.X - X[Index];
+		SumY += Value.Y - Y[Index];
+		X[Index] = Value.X;
+		Y[Index] = Value.Y;
+		Weights[Index] = Weight;
+	}
+	else
+	{
+		IndexByParticipant.Add(ParticipantId, ParticipantIds.Num());
+		ParticipantIds.Add(ParticipantId);
+		X.Add(Value.X);
+		Y.Add(Value.Y);
+		Weights.Add(Weight);
+		SumX += Value.X;
+		SumY += Value.Y;
+	}
+}
+
+void FMixerStickParticipantValues::Remove(uint32 ParticipantId)
+{
+	int32 Index;
+	if (IndexByParticipant.RemoveAndCopyValue(ParticipantId, Index))
+	{
+		SumX -= X[Index];
+		SumY -= Y[Index];
+
+		// Swap-remove keeps the arrays dense; patch the index of the participant that moved
+		const int32 LastIndex = ParticipantIds.Num() - 1;
+		if (Index != LastIndex)
+		{
+			IndexByParticipant.Add(ParticipantIds[LastIndex], Index);
+		}
+		ParticipantIds.RemoveAtSwap(Index, 1, false);
+		X.RemoveAtSwap(Index, 1, false);
+		Y.RemoveAtSwap(Index, 1, false);
+		Weights.RemoveAtSwap(Index, 1, false);
+
+		if (ParticipantIds.Num() == 0)
+		{
+			// Don't let rounding error accumulate across sessions of activity
+			SumX = 0.0;
+			SumY = 0.0;
+		}
+	}
+}
+
+void FMixerStickParticipantValues::Reset()
+{
+	X.Reset();
+	Y.Reset();
+	Weights.Reset();
+	ParticipantIds.Reset();
+	IndexByParticipant.Reset();
+	SumX = 0.0;
+	SumY = 0.0;
+}
+
+FMixerAdaptiveThrottleState::FMixerAdaptiveThrottleState()
+	: WindowStartTime(FPlatformTime::Seconds())
+	, DispatchSecondsThisFrame(0.0)
+	, PeakDispatchSecondsPerFrame(0.0)
+	, InputsThisFrame(0)
+	, InputsThisWindow(0)
+	, PeakInputsPerFrame(0)
+	, CurrentBytesPerSecond(0)
+{
+}
+
+FMixerParticipantSyncState::FMixerParticipantSyncState()
+	: NextPendingIndex(0)
+	, Cursor(0.0)
+	, PageRequestTime(0.0)
+	, ParticipantsSynced(0)
+	, ParticipantsTotal(0)
+	, PageRetries(0)
+	, bActive(false)
+	, bActiveParticipantsOnly(false)
+	, bPageRequestInFlight(false)
+	, bMorePages(false)
+{
+}
+
+FMixerVoteTally::FMixerVoteTally()
+	: WindowSeconds(0.0)
+	, bSliding(false)
+	, bUniqueVoters(false)
+	, NumGroups(1)
+	, WindowEndTime(0.0)
+	, BucketSeconds(0.0)
+	, CurrentBucketSerial(0)
+{
+}
+
+void FMixerVoteTally::Advance(double Now)
+{
+	if (bSliding)
+	{
+		const int64 NewBucketSerial = static_cast<int64>(Now / BucketSeconds);
+		const int32 NumBuckets = Buckets.Num();
+		if (NewBucketSerial - CurrentBucketSerial >= NumBuckets)
+		{
+			// Everything has expired
+			for (TArray<int32>& Bucket : Buckets)
+			{
+				FMemory::Memzero(Bucket.GetData(), Bucket.Num() * sizeof(int32));
+			}
+			FMemory::Memzero(WindowCounts.GetData(), WindowCounts.Num() * sizeof(int32));
+			CurrentBucketSerial = NewBucketSerial;
+		}
+		else
+		{
+			while (CurrentBucketSerial < NewBucketSerial)
+			{
+				++CurrentBucketSerial;
+				TArray<int32>& ExpiringBucket = Buckets[CurrentBucketSerial % NumBuckets];
+				for (int32 i = 0; i < ExpiringBucket.Num(); ++i)
+				{
+					WindowCounts[i] -= ExpiringBucket[i];
+				}
+				FMemory::Memzero(ExpiringBucket.GetData(), ExpiringBucket.Num() * sizeof(int32));
+			}
+		}
+	}
+	else if (Now >= WindowEndTime)
+	{
+		const double WindowsElapsed = FMath::FloorToDouble((Now - WindowEndTime) / WindowSeconds) + 1.0;
+		if (WindowsElapsed == 1.0)
+		{
+			Swap(CompletedWindowCounts, WindowCounts);
+		}
+		else
+		{
+			// At least one whole window passed with no activity
+			FMemory::Memzero(CompletedWindowCounts.GetData(), CompletedWindowCounts.Num() * sizeof(int32));
+		}
+		FMemory::Memzero(WindowCounts.GetData(), WindowCounts.Num() * sizeof(int32));
+		VotedThisWindow.Init(false, VotedThisWindow.Num());
+		WindowEndTime += WindowsElapsed * WindowSeconds;
+	}
+}
+
+int32 FMixerVoteTally::FindOrAddGroup(FName Group)
+{
+	const int32* ExistingIndex = GroupIndices.Find(Group);
+	if (ExistingIndex != nullptr)
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 NumOptions = Options.Num();
+	WindowCounts.AddZeroed(NumOptions);
+	CompletedWindowCounts.AddZeroed(NumOptions);
+	for (TArray<int32>& Bucket : Buckets)
+	{
+		Bucket.AddZeroed(NumOptions);
+	}
+	GroupIndices.Add(Group, NumGroups);
+	return NumGroups++;
+}
+
+void FMixerVoteTally::RecordVote(int32 OptionIndex, int32 VoterSlot, FName Group, double Now)
+{
+	Advance(Now);
+
+	if (bUniqueVoters)
+	{
+		if (bSliding)
+		{
+			while (LastCountedBucketBySlot.Num() <= VoterSlot)
+			{
+				LastCountedBucketBySlot.Add(TNumericLimits<int64>::Lowest());
+			}
+
+			if (LastCountedBucketBySlot[VoterSlot] > CurrentBucketSerial - Buckets.Num())
+			{
+				// Previous vote is still inside the window
+				return;
+			}
+			LastCountedBucketBySlot[VoterSlot] = CurrentBucketSerial;
+		}
+		else
+		{
+			while (VotedThisWindow.Num() <= VoterSlot)
+			{
+				VotedThisWindow.Add(false);
+			}
+
+			if (VotedThisWindow[VoterSlot])
+			{
+				return;
+			}
+			VotedThisWindow[VoterSlot] = true;
+		}
+	}
+
+	const int32 TotalIndex = OptionIndex;
+	const int32 GroupIndex = FindOrAddGroup(Group) * Options.Num() + OptionIndex;
+	WindowCounts[TotalIndex] += 1;
+	WindowCounts[GroupIndex] += 1;
+	if (bSliding)
+	{
+		TArray<int32>& CurrentBucket = Buckets[CurrentBucketSerial % Buckets.Num()];
+		CurrentBucket[TotalIndex] += 1;
+		CurrentBucket[GroupIndex] += 1;
+	}
+}
+
+FMixerHeatMap::FMixerHeatMap()
+	: Bounds(FVector2D(0, 0), FVector2D(1, 1))
+	, Width(0)
+	, Height(0)
+	, HalfLifeSeconds(0.0)
+	, LastDecayTime(0.0)
+	, MaxValue(0.0f)
+{
+}
+
+void FMixerHeatMap::Decay(double Now)
+{
+	const double Elapsed = Now - LastDecayTime;
+	LastDecayTime = Now;
+	if (HalfLifeSeconds <= 0.0 || Elapsed <= 0.0 || MaxValue == 0.0f)
+	{
+		return;
+	}
+
+	const float Factor = static_cast<float>(FMath::Pow(0.5, Elapsed / HalfLifeSeconds));
+	MaxValue *= Factor;
+	if (MaxValue < HeatMapClearThreshold)
+	{
+		FMemory::Memzero(Values.GetData(), Values.Num() * sizeof(float));
+		MaxValue = 0.0f;
+		return;
+	}
+
+	float* Cells = Values.GetData();
+	const int32 Num = Values.Num();
+	const VectorRegister VFactor = VectorSetFloat1(Factor);
+
+	int32 i = 0;
+	for (; i + 4 <= Num; i += 4)
+	{
+		VectorStore(VectorMultiply(VectorLoad(Cells + i), VFactor), Cells + i);
+	}
+
+	for (; i < Num; ++i)
+	{
+		Cells[i] *= Factor;
+	}
+}
+
+void FMixerHeatMap::Accumulate(FVector2D Position)
+{
+	if (!Bounds.IsInside(Position))
+	{
+		return;
+	}
+
+	const FVector2D Normalized = (Position - Bounds.Min) / Bounds.GetSize();
+	const int32 CellX = FMath::Min(static_cast<int32>(Normalized.X * Width), Width - 1);
+	const int32 CellY = FMath::Min(static_cast<int32>(Normalized.Y * Height), Height - 1);
+	float& Cell = Values[CellY * Width + CellX];
+	Cell += 1.0f;
+	MaxValue = FMath::Max(MaxValue, Cell);
+}
+
+FMixerInteractivityModule_WithSessionState::FMixerInteractivityModule_WithSessionState()
+	: ParticipantPool(MakeShared<FMixerRemoteUserPool>())
+	, bControlTableDirty(false)
+	, bPerParticipantState(false)
+{
+}
 
 void FMixerInteractivityModule_WithSessionState::TriggerButtonCooldown(FName Button, FTimespan CooldownTime)
 {
@@ -24,6 +542,83 @@ void FMixerInteractivityModule_WithSessionState::TriggerButtonCooldown(FName But
 	}
 }
 
+bool FMixerInteractivityModule_WithSessionState::StartVoteTally(FName TallyName, const TArray<FName>& Options, FTimespan Window, bool bSlidingWindow, bool bUniqueVoters)
+{
+	if (Options.Num() == 0 || Window <= FTimespan::Zero())
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Vote tally %s requires at least one option and a positive window."), *TallyName.ToString());
+		return false;
+	}
+
+	StopVoteTally(TallyName);
+
+	const double Now = FPlatformTime::Seconds();
+	FMixerVoteTally& Tally = VoteTallies[VoteTallies.AddDefaulted()];
+	Tally.Name = TallyName;
+	Tally.Options = Options;
+	Tally.WindowSeconds = Window.GetTotalSeconds();
+	Tally.bSliding = bSlidingWindow;
+	Tally.bUniqueVoters = bUniqueVoters;
+	Tally.WindowCounts.AddZeroed(Options.Num());
+	Tally.CompletedWindowCounts.AddZeroed(Options.Num());
+	if (bSlidingWindow)
+	{
+		Tally.BucketSeconds = Tally.WindowSeconds / VoteTallyBucketsPerWindow;
+		Tally.CurrentBucketSerial = static_cast<int64>(Now / Tally.BucketSeconds);
+		Tally.Buckets.SetNum(VoteTallyBucketsPerWindow);
+		for (TArray<int32>& Bucket : Tally.Buckets)
+		{
+			Bucket.AddZeroed(Options.Num());
+		}
+	}
+	else
+	{
+		Tally.WindowEndTime = Now + Tally.WindowSeconds;
+	}
+
+	RebuildVoteRoutes();
+	return true;
+}
+
+void FMixerInteractivityModule_WithSessionState::StopVoteTally(FName TallyName)
+{
+	const int32 NumRemoved = VoteTallies.RemoveAll([TallyName](const FMixerVoteTally& Tally) { return Tally.Name == TallyName; });
+	if (NumRemoved > 0)
+	{
+		RebuildVoteRoutes();
+	}
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetVoteTally(FName TallyName, FName GroupName, bool bLastCompletedWindow, TArray<int32>& OutCounts)
+{
+	FMixerVoteTally* Tally = VoteTallies.FindByPredicate([TallyName](const FMixerVoteTally& Candidate) { return Candidate.Name == TallyName; });
+	if (Tally == nullptr)
+	{
+		return false;
+	}
+
+	Tally->Advance(FPlatformTime::Seconds());
+
+	const int32 NumOptions = Tally->Options.Num();
+	OutCounts.SetNumZeroed(NumOptions);
+
+	int32 GroupIndex = 0;
+	if (GroupName != NAME_None)
+	{
+		const int32* ExistingIndex = Tally->GroupIndices.Find(GroupName);
+		if (ExistingIndex == nullptr)
+		{
+			// No votes from this group yet
+			return true;
+		}
+		GroupIndex = *ExistingIndex;
+	}
+
+	const TArray<int32>& Counts = (bLastCompletedWindow && !Tally->bSliding) ? Tally->CompletedWindowCounts : Tally->WindowCounts;
+	FMemory::Memcpy(OutCounts.GetData(), Counts.GetData() + GroupIndex * NumOptions, NumOptions * sizeof(int32));
+	return true;
+}
+
 bool FMixerInteractivityModule_WithSessionState::GetButtonDescription(FName Button, FMixerButtonDescription& OutDesc)
 {
 	FMixerButtonPropertiesCached* CachedProps = Buttons.Find(Button);
@@ -44,6 +639,7 @@ bool FMixerInteractivityModule_WithSessionState::GetButtonState(FName Button, FM
 	if (CachedProps != nullptr)
 	{
 		OutState = CachedProps->State;
+		OutState.RemainingCooldown = GetRemainingCooldown(*CachedProps);
 		if (!bPerParticipantState)
 		{
 			OutState.PressCount = 0;
@@ -66,6 +662,7 @@ bool FMixerInteractivityModule_WithSessionState::GetButtonState(FName Button, ui
 		if (CachedProps != nullptr)
 		{
 			OutState = CachedProps->State;
+			OutState.RemainingCooldown = GetRemainingCooldown(*CachedProps);
 
 			// Even with per-participant tracking on we don't maintain these.  
 			OutState.DownCount = 0;
@@ -130,8 +727,10 @@ bool FMixerInteractivityModule_WithSessionState::GetStickState(FName Stick, uint
 		{
 			OutState.Enabled = CachedProps->State.Enabled;
 
-			FVector2D* PerParticipantState = CachedProps->PerParticipantStickValue.Find(ParticipantId);
-			OutState.Axes = (PerParticipantState != nullptr) ? *PerParticipantState : FVector2D(0, 0);
+			if (!CachedProps->PerParticipantValues.Find(ParticipantId, OutState.Axes))
+			{
+				OutState.Axes = FVector2D(0, 0);
+			}
 			return true;
 		}
 		else
@@ -149,25 +748,82 @@ bool FMixerInteractivityModule_WithSessionState::GetStickState(FName Stick, uint
 	}
 }
 
-
-void FMixerInteractivityModule_WithSessionState::SetLabelText(FName Label, const FText& DisplayText)
+bool FMixerInteractivityModule_WithSessionState::GetStickStatistics(FName Stick, int32 DirectionBuckets, float Percentile, FMixerStickStatistics& OutStats)
 {
-	FMixerLabelPropertiesCached* CachedLabel = Labels.Find(Label);
-	if (CachedLabel != nullptr)
+	if (!bPerParticipantState)
 	{
-		TSharedRef<FJsonObject> UpdateJson = MakeShared<FJsonObject>();
-		UpdateJson->SetStringField(MixerStringConstants::FieldNames::Text, DisplayText.ToString());
-		UpdateRemoteControl(CachedLabel->SceneId, Label, UpdateJson);
+		if (GetInteractiveConnectionAuthState() != EMixerLoginState::Not_Logged_In)
+		{
+			UE_LOG(LogMixerInteractivity, Error, TEXT("Computing stick statistics requires that per-participant state caching is enabled."));
+		}
+		return false;
 	}
-}
 
-bool FMixerInteractivityModule_WithSessionState::GetLabelDescription(FName Label, FMixerLabelDescription& OutDesc)
-{
-	FMixerLabelPropertiesCached* CachedProps = Labels.Find(Label);
-	if (CachedProps != nullptr)
+	FMixerStickPropertiesCached* CachedProps = Sticks.Find(Stick);
+	if (CachedProps == nullptr)
 	{
-		OutDesc = CachedProps->Desc;
-		return true;
+		return false;
+	}
+
+	const FMixerStickParticipantValues& Values = CachedProps->PerParticipantValues;
+	const int32 Num = Values.Num();
+
+	OutStats = FMixerStickStatistics();
+	OutStats.ActiveParticipants = Num;
+	OutStats.DirectionHistogram.SetNumZeroed(FMath::Max(DirectionBuckets, 0));
+	if (Num == 0)
+	{
+		return true;
+	}
+
+	FStickValueSums Sums;
+	SumStickValues(Values, Sums);
+
+	OutStats.Mean = FVector2D(Sums.X / Num, Sums.Y / Num);
+	OutStats.Variance = FVector2D(
+		FMath::Max(static_cast<float>(Sums.XX / Num) - FMath::Square(OutStats.Mean.X), 0.0f),
+		FMath::Max(static_cast<float>(Sums.YY / Num) - FMath::Square(OutStats.Mean.Y), 0.0f));
+	OutStats.LevelWeightedMean = Sums.W > 0.0 ? FVector2D(Sums.WX / Sums.W, Sums.WY / Sums.W) : OutStats.Mean;
+
+	if (DirectionBuckets > 0)
+	{
+		const float BucketsPerRadian = DirectionBuckets / (2.0f * PI);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			// +0.5 so that bucket 0 is centered on +X rather than starting there
+			int32 Bucket = FMath::FloorToInt(FMath::Atan2(Values.Y[i], Values.X[i]) * BucketsPerRadian + 0.5f);
+			Bucket = ((Bucket % DirectionBuckets) + DirectionBuckets) % DirectionBuckets;
+			++OutStats.DirectionHistogram[Bucket];
+		}
+	}
+
+	// Squared magnitudes order the same as magnitudes, so only the selected one needs a sqrt
+	ComputeSquaredMagnitudes(Values, StickMagnitudeScratch);
+	StickMagnitudeScratch.Sort();
+	const int32 PercentileIndex = FMath::Clamp(FMath::RoundToInt(FMath::Clamp(Percentile, 0.0f, 1.0f) * (Num - 1)), 0, Num - 1);
+	OutStats.MagnitudeAtPercentile = FMath::Sqrt(StickMagnitudeScratch[PercentileIndex]);
+
+	return true;
+}
+
+void FMixerInteractivityModule_WithSessionState::SetLabelText(FName Label, const FText& DisplayText)
+{
+	FMixerLabelPropertiesCached* CachedLabel = Labels.Find(Label);
+	if (CachedLabel != nullptr)
+	{
+		TSharedRef<FJsonObject> UpdateJson = MakeShared<FJsonObject>();
+		UpdateJson->SetStringField(MixerStringConstants::FieldNames::Text, DisplayText.ToString());
+		UpdateRemoteControl(CachedLabel->SceneId, Label, UpdateJson);
+	}
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetLabelDescription(FName Label, FMixerLabelDescription& OutDesc)
+{
+	FMixerLabelPropertiesCached* CachedProps = Labels.Find(Label);
+	if (CachedProps != nullptr)
+	{
+		OutDesc = CachedProps->Desc;
+		return true;
 	}
 	else
 	{
@@ -212,20 +868,109 @@ bool FMixerInteractivityModule_WithSessionState::Tick(float DeltaTime)
 {
 	FMixerInteractivityModule::Tick(DeltaTime);
 
-	FTimespan CooldownDecrement = FTimespan::FromSeconds(DeltaTime);
-	for (TMap<FName, FMixerButtonPropertiesCached>::TIterator It(Buttons); It; ++It)
+	// Cooldowns are stored as deadlines, so only buttons that saw input last frame need attention
+	for (FName ControlId : ButtonsWithDirtyFrameCounters)
 	{
-		It->Value.State.RemainingCooldown = FMath::Max(It->Value.State.RemainingCooldown - CooldownDecrement, FTimespan::Zero());
+		FMixerButtonPropertiesCached* ButtonProps = Buttons.Find(ControlId);
+		if (ButtonProps != nullptr)
+		{
+			ButtonProps->State.DownCount = 0;
+			ButtonProps->State.UpCount = 0;
+			ButtonProps->bFrameCountersDirty = false;
 
-		It->Value.State.DownCount = 0;
-		It->Value.State.UpCount = 0;
+			// Leave PressCount alone
+		}
+	}
+	ButtonsWithDirtyFrameCounters.Reset();
 
-		// Leave PressCount alone
+	if (HeatMaps.Num() > 0)
+	{
+		const double Now = FPlatformTime::Seconds();
+		for (TPair<FName, FMixerHeatMap>& HeatMap : HeatMaps)
+		{
+			HeatMap.Value.Decay(Now);
+		}
 	}
 
+	TickAdaptiveThrottle();
+
+	TickParticipantSync();
+
+	// Deliver anything held back by the per-frame budget on earlier frames
+	FlushParticipantStateChanges();
+
 	return true;
 }
 
+void FMixerInteractivityModule_WithSessionState::TickAdaptiveThrottle()
+{
+	// Fold the frame that just finished into the current measurement window
+	AdaptiveThrottle.InputsThisWindow += AdaptiveThrottle.InputsThisFrame;
+	AdaptiveThrottle.PeakInputsPerFrame = FMath::Max(AdaptiveThrottle.PeakInputsPerFrame, AdaptiveThrottle.InputsThisFrame);
+	AdaptiveThrottle.PeakDispatchSecondsPerFrame = FMath::Max(AdaptiveThrottle.PeakDispatchSecondsPerFrame, AdaptiveThrottle.DispatchSecondsThisFrame);
+	AdaptiveThrottle.InputsThisFrame = 0;
+	AdaptiveThrottle.DispatchSecondsThisFrame = 0.0;
+
+	const double TimeNow = FPlatformTime::Seconds();
+	const double WindowLength = TimeNow - AdaptiveThrottle.WindowStartTime;
+	if (WindowLength < AdaptiveThrottleWindowSeconds)
+	{
+		return;
+	}
+
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	if (Settings->bAdaptiveInputThrottling && GetInteractiveConnectionAuthState() == EMixerLoginState::Logged_In)
+	{
+		const double InputsPerSecond = AdaptiveThrottle.InputsThisWindow / WindowLength;
+		const double PeakDispatchMs = AdaptiveThrottle.PeakDispatchSecondsPerFrame * 1000.0;
+		const uint32 PeakInputsPerFrame = AdaptiveThrottle.PeakInputsPerFrame;
+
+		const bool bOverloaded = InputsPerSecond > Settings->AdaptiveThrottleMaxInputsPerSecond
+			|| PeakDispatchMs > Settings->AdaptiveThrottleMaxDispatchMsPerFrame
+			|| PeakInputsPerFrame > static_cast<uint32>(Settings->AdaptiveThrottleMaxInputsPerFrame);
+
+		const bool bUnderloaded = InputsPerSecond < Settings->AdaptiveThrottleMaxInputsPerSecond * 0.5
+			&& PeakDispatchMs < Settings->AdaptiveThrottleMaxDispatchMsPerFrame * 0.5
+			&& PeakInputsPerFrame < static_cast<uint32>(Settings->AdaptiveThrottleMaxInputsPerFrame / 2);
+
+		const uint32 MinBytesPerSecond = static_cast<uint32>(FMath::Max(Settings->AdaptiveThrottleMinBytesPerSecond, 1));
+		const uint32 MaxBytesPerSecond = FMath::Max(static_cast<uint32>(Settings->AdaptiveThrottleMaxBytesPerSecond), MinBytesPerSecond);
+
+		// Multiplicative decrease, additive increase.  Once engaged the controller never lifts
+		// the throttle entirely - it relaxes back to the configured maximum.
+		uint32 NewBytesPerSecond = AdaptiveThrottle.CurrentBytesPerSecond;
+		if (bOverloaded)
+		{
+			NewBytesPerSecond = AdaptiveThrottle.CurrentBytesPerSecond == 0 ? MaxBytesPerSecond : AdaptiveThrottle.CurrentBytesPerSecond / 2;
+		}
+		else if (bUnderloaded && AdaptiveThrottle.CurrentBytesPerSecond != 0)
+		{
+			NewBytesPerSecond = AdaptiveThrottle.CurrentBytesPerSecond + FMath::Max((MaxBytesPerSecond - MinBytesPerSecond) / 8, 1u);
+		}
+
+		if (NewBytesPerSecond != 0)
+		{
+			NewBytesPerSecond = FMath::Clamp(NewBytesPerSecond, MinBytesPerSecond, MaxBytesPerSecond);
+		}
+
+		if (NewBytesPerSecond != AdaptiveThrottle.CurrentBytesPerSecond)
+		{
+			UE_LOG(LogMixerInteractivity, Verbose, TEXT("Adjusting input throttle to %u bytes/s (%.1f inputs/s, peak %u inputs and %.2f ms in a single frame)"),
+				NewBytesPerSecond, InputsPerSecond, PeakInputsPerFrame, PeakDispatchMs);
+
+			if (SetBandwidthThrottle(EMixerInteractivityThrottle::Input, NewBytesPerSecond, NewBytesPerSecond))
+			{
+				AdaptiveThrottle.CurrentBytesPerSecond = NewBytesPerSecond;
+			}
+		}
+	}
+
+	AdaptiveThrottle.WindowStartTime = TimeNow;
+	AdaptiveThrottle.InputsThisWindow = 0;
+	AdaptiveThrottle.PeakInputsPerFrame = 0;
+	AdaptiveThrottle.PeakDispatchSecondsPerFrame = 0.0;
+}
+
 bool FMixerInteractivityModule_WithSessionState::HandleSingleControlUpdate(FName ControlId, const TSharedRef<FJsonObject> ControlData)
 {
 	FMixerButtonPropertiesCached* ButtonProps = Buttons.Find(ControlId);
@@ -234,14 +979,16 @@ bool FMixerInteractivityModule_WithSessionState::HandleSingleControlUpdate(FName
 		double Cooldown = 0.0f;
 		if (ControlData->TryGetNumberField(MixerStringConstants::FieldNames::Cooldown, Cooldown))
 		{
+			// Convert from the service's wall clock deadline to the local monotonic clock once, here,
+			// so that reads are immune to subsequent local clock adjustments.
 			uint64 TimeNowInMixerUnits = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
 			if (Cooldown > TimeNowInMixerUnits)
 			{
-				ButtonProps->State.RemainingCooldown = FTimespan::FromMilliseconds(static_cast<double>(static_cast<uint64>(Cooldown) - TimeNowInMixerUnits));
+				ButtonProps->CooldownEndTime = FPlatformTime::Seconds() + (static_cast<uint64>(Cooldown) - TimeNowInMixerUnits) / 1000.0;
 			}
 			else
 			{
-				ButtonProps->State.RemainingCooldown = FTimespan::Zero();
+				ButtonProps->CooldownEndTime = 0.0;
 			}
 		}
 
@@ -299,19 +1046,38 @@ void FMixerInteractivityModule_WithSessionState::StartSession(bool bCachePerPart
 	check(Sticks.Num() == 0);
 	check(Labels.Num() == 0);
 	check(Textboxes.Num() == 0);
+	check(CustomControls.Num() == 0);
 	check(RemoteParticipantCacheByGuid.Num() == 0);
 	check(RemoteParticipantCacheByUint.Num() == 0);
+	check(RemoteParticipantCacheBySessionId.Num() == 0);
 	bPerParticipantState = bCachePerParticipantState;
+	AdaptiveThrottle = FMixerAdaptiveThrottleState();
 }
 
 void FMixerInteractivityModule_WithSessionState::EndSession()
 {
 	Buttons.Empty();
+	ButtonsWithDirtyFrameCounters.Empty();
 	Sticks.Empty();
 	Labels.Empty();
 	Textboxes.Empty();
+	CustomControls.Empty();
+	ControlTable.Empty();
+	ControlTableIndexByHash.Empty();
+	bControlTableDirty = false;
 	RemoteParticipantCacheByGuid.Empty();
 	RemoteParticipantCacheByUint.Empty();
+	RemoteParticipantCacheBySessionId.Empty();
+	CancelParticipantSync();
+	DiscardParticipantStateChanges();
+
+	// Voter slots are per session, so unique-voter state keyed by them must go too.  Tallies themselves are kept.
+	VoterSlots.Empty();
+	for (FMixerVoteTally& Tally : VoteTallies)
+	{
+		Tally.VotedThisWindow.Empty();
+		Tally.LastCountedBucketBySlot.Empty();
+	}
 }
 
 bool FMixerInteractivityModule_WithSessionState::CachePerParticipantState()
@@ -322,6 +1088,7 @@ bool FMixerInteractivityModule_WithSessionState::CachePerParticipantState()
 void FMixerInteractivityModule_WithSessionState::AddButton(FName ControlId, const FMixerButtonPropertiesCached& Props)
 {
 	Buttons.Add(ControlId, Props);
+	bControlTableDirty = true;
 }
 
 FMixerButtonPropertiesCached* FMixerInteractivityModule_WithSessionState::GetButton(FName ControlId)
@@ -329,9 +1096,108 @@ FMixerButtonPropertiesCached* FMixerInteractivityModule_WithSessionState::GetBut
 	return Buttons.Find(ControlId);
 }
 
+void FMixerInteractivityModule_WithSessionState::MarkButtonFrameCountersDirty(FName ControlId, FMixerButtonPropertiesCached& Props)
+{
+	if (!Props.bFrameCountersDirty)
+	{
+		Props.bFrameCountersDirty = true;
+		ButtonsWithDirtyFrameCounters.Add(ControlId);
+	}
+}
+
 void FMixerInteractivityModule_WithSessionState::AddStick(FName ControlId, const FMixerStickPropertiesCached& Props)
 {
 	Sticks.Add(ControlId, Props);
+	bControlTableDirty = true;
+}
+
+void FMixerInteractivityModule_WithSessionState::RecordButtonVote(FName ControlId, const FMixerRemoteUser& Participant)
+{
+	const TArray<TPair<int32, int32>, TInlineAllocator<1>>* Routes = VoteRoutes.Find(ControlId);
+	if (Routes == nullptr)
+	{
+		return;
+	}
+
+	int32 VoterSlot;
+	const int32* ExistingSlot = VoterSlots.Find(Participant.Id);
+	if (ExistingSlot != nullptr)
+	{
+		VoterSlot = *ExistingSlot;
+	}
+	else
+	{
+		VoterSlot = VoterSlots.Num();
+		VoterSlots.Add(Participant.Id, VoterSlot);
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	for (const TPair<int32, int32>& Route : *Routes)
+	{
+		VoteTallies[Route.Key].RecordVote(Route.Value, VoterSlot, Participant.Group, Now);
+	}
+}
+
+void FMixerInteractivityModule_WithSessionState::RebuildVoteRoutes()
+{
+	VoteRoutes.Reset();
+	for (int32 TallyIndex = 0; TallyIndex < VoteTallies.Num(); ++TallyIndex)
+	{
+		const TArray<FName>& Options = VoteTallies[TallyIndex].Options;
+		for (int32 OptionIndex = 0; OptionIndex < Options.Num(); ++OptionIndex)
+		{
+			VoteRoutes.FindOrAdd(Options[OptionIndex]).Add(TPair<int32, int32>(TallyIndex, OptionIndex));
+		}
+	}
+}
+
+bool FMixerInteractivityModule_WithSessionState::StartHeatMap(FName Control, int32 Width, int32 Height, const FBox2D& Bounds, FTimespan HalfLife)
+{
+	const FVector2D BoundsSize = Bounds.GetSize();
+	if (Width <= 0 || Height <= 0 || Width > MaxHeatMapCells / Height || BoundsSize.X <= 0 || BoundsSize.Y <= 0)
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("Heat map for %s requires a positive grid size (at most %d cells) and non-empty bounds."), *Control.ToString(), MaxHeatMapCells);
+		return false;
+	}
+
+	FMixerHeatMap& HeatMap = HeatMaps.Add(Control, FMixerHeatMap());
+	HeatMap.Bounds = Bounds;
+	HeatMap.Width = Width;
+	HeatMap.Height = Height;
+	HeatMap.HalfLifeSeconds = HalfLife.GetTotalSeconds();
+	HeatMap.LastDecayTime = FPlatformTime::Seconds();
+	HeatMap.Values.AddZeroed(Width * Height);
+	return true;
+}
+
+void FMixerInteractivityModule_WithSessionState::StopHeatMap(FName Control)
+{
+	HeatMaps.Remove(Control);
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetHeatMap(FName Control, int32& OutWidth, int32& OutHeight, TArrayView<const float>& OutValues, float& OutMaxValue)
+{
+	const FMixerHeatMap* HeatMap = HeatMaps.Find(Control);
+	if (HeatMap == nullptr)
+	{
+		return false;
+	}
+
+	// Decay is applied once per tick, so the view is at most a frame stale
+	OutWidth = HeatMap->Width;
+	OutHeight = HeatMap->Height;
+	OutValues = HeatMap->Values;
+	OutMaxValue = HeatMap->MaxValue;
+	return true;
+}
+
+void FMixerInteractivityModule_WithSessionState::RecordHeatMapClick(FName ControlId, FVector2D Position)
+{
+	FMixerHeatMap* HeatMap = HeatMaps.Find(ControlId);
+	if (HeatMap != nullptr)
+	{
+		HeatMap->Accumulate(Position);
+	}
 }
 
 FMixerStickPropertiesCached* FMixerInteractivityModule_WithSessionState::GetStick(FName ControlId)
@@ -339,9 +1205,26 @@ FMixerStickPropertiesCached* FMixerInteractivityModule_WithSessionState::GetStic
 	return Sticks.Find(ControlId);
 }
 
+void FMixerInteractivityModule_WithSessionState::UpdateStickParticipantValue(FMixerStickPropertiesCached& Props, const FMixerRemoteUser& Participant, FVector2D Value)
+{
+	FMixerStickParticipantValues& Values = Props.PerParticipantValues;
+	if (Value.X != 0 || Value.Y != 0)
+	{
+		Values.Set(Participant.Id, Value, static_cast<float>(FMath::Max(Participant.Level, 1)));
+	}
+	else
+	{
+		Values.Remove(Participant.Id);
+	}
+
+	const int32 Num = Values.Num();
+	Props.State.Axes = Num > 0 ? FVector2D(Values.SumX / Num, Values.SumY / Num) : FVector2D(0, 0);
+}
+
 void FMixerInteractivityModule_WithSessionState::AddLabel(FName ControlId, const FMixerLabelPropertiesCached& Props)
 {
 	Labels.Add(ControlId, Props);
+	bControlTableDirty = true;
 }
 
 FMixerLabelPropertiesCached* FMixerInteractivityModule_WithSessionState::GetLabel(FName ControlId)
@@ -352,6 +1235,7 @@ FMixerLabelPropertiesCached* FMixerInteractivityModule_WithSessionState::GetLabe
 void FMixerInteractivityModule_WithSessionState::AddTextbox(FName ControlId, const FMixerTextboxPropertiesCached& Props)
 {
 	Textboxes.Add(ControlId, Props);
+	bControlTableDirty = true;
 }
 
 FMixerTextboxPropertiesCached* FMixerInteractivityModule_WithSessionState::GetTextbox(FName ControlId)
@@ -359,22 +1243,182 @@ FMixerTextboxPropertiesCached* FMixerInteractivityModule_WithSessionState::GetTe
 	return Textboxes.Find(ControlId);
 }
 
+void FMixerInteractivityModule_WithSessionState::AddCustomControl(FName ControlId, FName SceneId)
+{
+	CustomControls.Add(ControlId, SceneId);
+	bControlTableDirty = true;
+}
+
+void FMixerInteractivityModule_WithSessionState::RemoveControl(FName ControlId)
+{
+	// Control ids are unique across kinds, so at most one of these does anything
+	int32 NumRemoved = Buttons.Remove(ControlId);
+	NumRemoved += Sticks.Remove(ControlId);
+	NumRemoved += Labels.Remove(ControlId);
+	NumRemoved += Textboxes.Remove(ControlId);
+	NumRemoved += CustomControls.Remove(ControlId);
+	if (NumRemoved > 0)
+	{
+		bControlTableDirty = true;
+	}
+
+	// A control recreated under the same name starts from scratch rather than inheriting
+	// the old one's clicks and votes
+	HeatMaps.Remove(ControlId);
+	VoteRoutes.Remove(ControlId);
+}
+
+bool FMixerInteractivityModule_WithSessionState::FindControlKind(FName ControlId, EMixerControlKind& OutKind) const
+{
+	if (Buttons.Contains(ControlId))
+	{
+		OutKind = EMixerControlKind::Button;
+	}
+	else if (Sticks.Contains(ControlId))
+	{
+		OutKind = EMixerControlKind::Stick;
+	}
+	else if (Labels.Contains(ControlId))
+	{
+		OutKind = EMixerControlKind::Label;
+	}
+	else if (Textboxes.Contains(ControlId))
+	{
+		OutKind = EMixerControlKind::Textbox;
+	}
+	else if (CustomControls.Contains(ControlId))
+	{
+		OutKind = EMixerControlKind::Custom;
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+const FMixerControlTableEntry* FMixerInteractivityModule_WithSessionState::FindControl(const TCHAR* RawControlId)
+{
+	if (bControlTableDirty)
+	{
+		RebuildControlTable();
+	}
+
+	return FindInControlTable(ControlTable, ControlTableIndexByHash, RawControlId);
+}
+
+const FMixerControlTableEntry* FMixerInteractivityModule_WithSessionState::FindControl(const ANSICHAR* RawControlId)
+{
+	for (const ANSICHAR* Char = RawControlId; *Char; ++Char)
+	{
+		if (static_cast<uint8>(*Char) >= 0x80)
+		{
+			// Table keys are decoded strings - fall back to decoding for non-ASCII ids.
+			return FindControl(UTF8_TO_TCHAR(RawControlId));
+		}
+	}
+
+	if (bControlTableDirty)
+	{
+		RebuildControlTable();
+	}
+
+	return FindInControlTable(ControlTable, ControlTableIndexByHash, RawControlId);
+}
+
+EMixerInputEventType FMixerInteractivityModule_WithSessionState::ParseInputEventType(const TCHAR* EventType, int32 EventTypeLength)
+{
+	return ParseInputEventTypeInternal(EventType, EventTypeLength);
+}
+
+EMixerInputEventType FMixerInteractivityModule_WithSessionState::ParseInputEventType(const ANSICHAR* EventType, int32 EventTypeLength)
+{
+	return ParseInputEventTypeInternal(EventType, EventTypeLength);
+}
+
+bool FMixerInteractivityModule_WithSessionState::GetInputCoordinates(const FJsonObject* InputJson, FVector2D& OutPosition)
+{
+	// Clicks only carry a position when the client chooses to send one
+	double X, Y;
+	if (InputJson->TryGetNumberField(MixerStringConstants::FieldNames::X, X) && InputJson->TryGetNumberField(MixerStringConstants::FieldNames::Y, Y))
+	{
+		OutPosition = FVector2D(static_cast<float>(X), static_cast<float>(Y));
+		return true;
+	}
+	return false;
+}
+
+void FMixerInteractivityModule_WithSessionState::RebuildControlTable()
+{
+	// Cached records live in TMaps whose storage moves as controls are added, so
+	// pointers are re-resolved in bulk here rather than on every input.
+	ControlTable.Reset(Buttons.Num() + Sticks.Num() + Labels.Num() + Textboxes.Num() + CustomControls.Num());
+	ControlTableIndexByHash.Reset();
+
+	for (TMap<FName, FMixerButtonPropertiesCached>::TIterator It(Buttons); It; ++It)
+	{
+		FMixerControlTableEntry Entry(It->Key.ToString(), It->Key, EMixerControlKind::Button);
+		Entry.Button = &It->Value;
+		AddControlTableEntry(MoveTemp(Entry));
+	}
+
+	for (TMap<FName, FMixerStickPropertiesCached>::TIterator It(Sticks); It; ++It)
+	{
+		FMixerControlTableEntry Entry(It->Key.ToString(), It->Key, EMixerControlKind::Stick);
+		Entry.Stick = &It->Value;
+		AddControlTableEntry(MoveTemp(Entry));
+	}
+
+	for (TMap<FName, FMixerLabelPropertiesCached>::TIterator It(Labels); It; ++It)
+	{
+		FMixerControlTableEntry Entry(It->Key.ToString(), It->Key, EMixerControlKind::Label);
+		Entry.Label = &It->Value;
+		AddControlTableEntry(MoveTemp(Entry));
+	}
+
+	for (TMap<FName, FMixerTextboxPropertiesCached>::TIterator It(Textboxes); It; ++It)
+	{
+		FMixerControlTableEntry Entry(It->Key.ToString(), It->Key, EMixerControlKind::Textbox);
+		Entry.Textbox = &It->Value;
+		AddControlTableEntry(MoveTemp(Entry));
+	}
+
+	for (TMap<FName, FName>::TConstIterator It(CustomControls); It; ++It)
+	{
+		AddControlTableEntry(FMixerControlTableEntry(It->Key.ToString(), It->Key, EMixerControlKind::Custom));
+	}
+
+	bControlTableDirty = false;
+}
+
+void FMixerInteractivityModule_WithSessionState::AddControlTableEntry(FMixerControlTableEntry&& Entry)
+{
+	const uint32 Hash = HashControlId(*Entry.RawId);
+	const int32* FirstIndex = ControlTableIndexByHash.Find(Hash);
+	Entry.NextWithSameHash = FirstIndex != nullptr ? *FirstIndex : INDEX_NONE;
+	ControlTableIndexByHash.Add(Hash, ControlTable.Add(MoveTemp(Entry)));
+}
+
 void FMixerInteractivityModule_WithSessionState::AddUser(TSharedPtr<FMixerRemoteUser> User)
 {
 	RemoteParticipantCacheByGuid.Add(User->SessionGuid, User);
 	RemoteParticipantCacheByUint.Add(User->Id, User);
+	RemoteParticipantCacheBySessionId.Add(MakeSessionIdKey(User->SessionGuid), User);
 }
 
 void FMixerInteractivityModule_WithSessionState::RemoveUser(TSharedPtr<FMixerRemoteUser> User)
 {
 	RemoteParticipantCacheByGuid.Remove(User->SessionGuid);
 	RemoteParticipantCacheByUint.Remove(User->Id);
+	RemoteParticipantCacheBySessionId.Remove(MakeSessionIdKey(User->SessionGuid));
 }
 
 void FMixerInteractivityModule_WithSessionState::RemoveUser(FGuid ParticipantSessionId)
 {
 	TSharedPtr<FMixerRemoteUser> RemovedUser = RemoteParticipantCacheByGuid.FindAndRemoveChecked(ParticipantSessionId);
 	RemoteParticipantCacheByUint.Remove(RemovedUser->Id);
+	RemoteParticipantCacheBySessionId.Remove(MakeSessionIdKey(ParticipantSessionId));
 }
 
 TSharedPtr<FMixerRemoteUser> FMixerInteractivityModule_WithSessionState::GetCachedUser(uint32 ParticipantId)
@@ -389,6 +1433,48 @@ TSharedPtr<FMixerRemoteUser> FMixerInteractivityModule_WithSessionState::GetCach
 	return User != nullptr ? *User : nullptr;
 }
 
+TSharedPtr<FMixerRemoteUser> FMixerInteractivityModule_WithSessionState::GetCachedUser(const TCHAR* RawParticipantSessionId, int32 Length)
+{
+	bool bKeyValid;
+	TSharedPtr<FMixerRemoteUser> User = FindBySessionId(RemoteParticipantCacheBySessionId, RawParticipantSessionId, Length, bKeyValid);
+	if (!bKeyValid)
+	{
+		// Unexpected format - take the slow path
+		FGuid ParticipantGuid;
+		FString ParticipantGuidString = FString(Length, RawParticipantSessionId);
+		if (FGuid::Parse(ParticipantGuidString, ParticipantGuid))
+		{
+			User = GetCachedUser(ParticipantGuid);
+		}
+		else
+		{
+			LogMalformedSessionId(ParticipantGuidString);
+		}
+	}
+	return User;
+}
+
+TSharedPtr<FMixerRemoteUser> FMixerInteractivityModule_WithSessionState::GetCachedUser(const ANSICHAR* RawParticipantSessionId, int32 Length)
+{
+	bool bKeyValid;
+	TSharedPtr<FMixerRemoteUser> User = FindBySessionId(RemoteParticipantCacheBySessionId, RawParticipantSessionId, Length, bKeyValid);
+	if (!bKeyValid)
+	{
+		// Unexpected format - take the slow path
+		FGuid ParticipantGuid;
+		FString ParticipantGuidString = FString(UTF8_TO_TCHAR(RawParticipantSessionId));
+		if (FGuid::Parse(ParticipantGuidString, ParticipantGuid))
+		{
+			User = GetCachedUser(ParticipantGuid);
+		}
+		else
+		{
+			LogMalformedSessionId(ParticipantGuidString);
+		}
+	}
+	return User;
+}
+
 void FMixerInteractivityModule_WithSessionState::ReassignUsers(FName FromGroup, FName ToGroup)
 {
 	for (TMap<uint32, TSharedPtr<FMixerRemoteUser>>::TConstIterator It(RemoteParticipantCacheByUint); It; ++It)
@@ -398,4 +1484,550 @@ void FMixerInteractivityModule_WithSessionState::ReassignUsers(FName FromGroup,
 			It->Value->Group = ToGroup;
 		}
 	}
-}
\ No newline at end of file
+}
+
+FMixerRemoteUserPool::~FMixerRemoteUserPool()
+{
+	for (FMixerRemoteUser* User : FreeUsers)
+	{
+		delete User;
+	}
+}
+
+TSharedRef<FMixerRemoteUser> FMixerRemoteUserPool::Allocate()
+{
+	FMixerRemoteUser* User = FreeUsers.Num() > 0 ? FreeUsers.Pop(false) : new FMixerRemoteUser();
+
+	// The deleter keeps the pool alive for as long as any record it handed out
+	TSharedRef<FMixerRemoteUserPool> Pool = AsShared();
+	return TSharedRef<FMixerRemoteUser>(User, [Pool](FMixerRemoteUser* ReleasedUser)
+	{
+		Pool->Release(ReleasedUser);
+	});
+}
+
+void FMixerRemoteUserPool::Release(FMixerRemoteUser* User)
+{
+	if (FreeUsers.Num() < MaxPooledParticipants)
+	{
+		*User = FMixerRemoteUser();
+		FreeUsers.Add(User);
+	}
+	else
+	{
+		delete User;
+	}
+}
+
+TSharedPtr<FMixerRemoteUser> FMixerInteractivityModule_WithSessionState::AllocateUser()
+{
+	return ParticipantPool->Allocate();
+}
+
+void FMixerInteractivityModule_WithSessionState::RecordInputDispatch(double DispatchStartTime)
+{
+	AdaptiveThrottle.InputsThisFrame += 1;
+	AdaptiveThrottle.DispatchSecondsThisFrame += FPlatformTime::Seconds() - DispatchStartTime;
+}
+
+bool FMixerInteractivityModule_WithSessionState::HandleSingleParticipantChange(const FJsonObject* JsonObj, EMixerInteractivityParticipantState EventType)
+{
+	GET_JSON_STRING_RETURN_FAILURE(UserNameNoUnderscore, Username);
+	GET_JSON_INT_RETURN_FAILURE(UserIdNoUnderscore, UserId);
+	GET_JSON_INT_RETURN_FAILURE(Level, UserLevel);
+	GET_JSON_DOUBLE_RETURN_FAILURE(LastInputAt, LastInputAtDouble);
+	GET_JSON_DOUBLE_RETURN_FAILURE(ConnectedAt, ConnectedAtDouble);
+	GET_JSON_STRING_RETURN_FAILURE(GroupId, GroupId);
+	GET_JSON_STRING_RETURN_FAILURE(SessionId, SessionGuidString);
+
+	FGuid SessionGuid;
+	if (!FGuid::Parse(SessionGuidString, SessionGuid))
+	{
+		UE_LOG(LogMixerInteractivity, Error, TEXT("sessionID field %s for participant event was not in the expected format (guid)"), *SessionGuidString);
+		return false;
+	}
+
+	TSharedPtr<FMixerRemoteUser> RemoteUser = GetCachedUser(UserId);
+	bool bOldInputEnabled = false;
+	bool bExistingUser = false;
+	if (RemoteUser.IsValid())
+	{
+		bExistingUser = true;
+		bOldInputEnabled = RemoteUser->InputEnabled;
+	}
+	else
+	{
+		RemoteUser = AllocateUser();
+		RemoteUser->Id = UserId;
+		RemoteUser->SessionGuid = SessionGuid;
+		RemoteUser->ConnectedAt = FDateTime::FromUnixTimestamp(static_cast<int64>(ConnectedAtDouble / 1000.0));
+
+		if (EventType != EMixerInteractivityParticipantState::Left)
+		{
+			AddUser(RemoteUser);
+		}
+	}
+
+	RemoteUser->Name = Username;
+	RemoteUser->Level = UserLevel;
+	RemoteUser->InputAt = FDateTime::FromUnixTimestamp(static_cast<int64>(LastInputAtDouble / 1000.0));
+	RemoteUser->Group = *GroupId;
+
+	if (EventType != EMixerInteractivityParticipantState::Input_Disabled || bOldInputEnabled != RemoteUser->InputEnabled)
+	{
+		QueueParticipantStateChange(RemoteUser, EventType);
+	}
+
+	if (bExistingUser && EventType == EMixerInteractivityParticipantState::Left)
+	{
+		RemoveUser(RemoteUser);
+	}
+
+	return true;
+}
+
+void FMixerInteractivityModule_WithSessionState::BeginParticipantSync()
+{
+	const UMixerInteractivitySettings* Settings = GetDefault<UMixerInteractivitySettings>();
+	if (!Settings->bSyncParticipantsOnConnect)
+	{
+		return;
+	}
+
+	ParticipantSync = FMixerParticipantSyncState();
+	ParticipantSync.bActive = true;
+	ParticipantSync.bMorePages = true;
+	ParticipantSync.bActiveParticipantsOnly = Settings->bSyncActiveParticipantsOnly;
+	if (ParticipantSync.bActiveParticipantsOnly)
+	{
+		const int64 ThresholdUnixSeconds = FDateTime::UtcNow().ToUnixTimestamp() - Settings->ActiveParticipantSyncThresholdSeconds;
+		ParticipantSync.Cursor = static_cast<double>(ThresholdUnixSeconds) * 1000.0;
+	}
+
+	RequestParticipantSyncPage();
+}
+
+void FMixerInteractivityModule_WithSessionState::CancelParticipantSync()
+{
+	// Anything still in flight will be ignored by HandleParticipantSyncPage
+	ParticipantSync = FMixerParticipantSyncState();
+}
+
+bool FMixerInteractivityModule_WithSessionState::IsAwaitingParticipantSyncPage() const
+{
+	return ParticipantSync.bActive && ParticipantSync.bPageRequestInFlight;
+}
+
+bool FMixerInteractivityModule_WithSessionState::HandleParticipantSyncPage(const FJsonObject* JsonObj)
+{
+	if (!IsAwaitingParticipantSyncPage())
+	{
+		// Reply to a sync that was cancelled or has already moved on
+		return true;
+	}
+
+	GET_JSON_ARRAY_RETURN_FAILURE(Participants, PageParticipants);
+
+	int32 Total = 0;
+	if (JsonObj->TryGetNumberField(MixerStringConstants::FieldNames::Total, Total))
+	{
+		ParticipantSync.ParticipantsTotal = Total;
+	}
+
+	bool bHasMore = false;
+	JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::HasMore, bHasMore);
+
+	const FString& CursorField = ParticipantSync.bActiveParticipantsOnly ? MixerStringConstants::FieldNames::LastInputAt : MixerStringConstants::FieldNames::ConnectedAt;
+	double NewCursor = ParticipantSync.Cursor;
+	for (const TSharedPtr<FJsonValue>& Participant : *PageParticipants)
+	{
+		const TSharedPtr<FJsonObject>* ParticipantObj;
+		double ParticipantCursor;
+		if (Participant.IsValid() && Participant->TryGetObject(ParticipantObj) && (*ParticipantObj)->TryGetNumberField(CursorField, ParticipantCursor))
+		{
+			NewCursor = FMath::Max(NewCursor, ParticipantCursor);
+		}
+	}
+
+	// A page that doesn't advance the cursor would be requested forever
+	ParticipantSync.bMorePages = bHasMore && NewCursor > ParticipantSync.Cursor;
+	if (bHasMore && !ParticipantSync.bMorePages)
+	{
+		UE_LOG(LogMixerInteractivity, Warning, TEXT("Participant sync stopped early - page did not advance past %.0f"), ParticipantSync.Cursor);
+	}
+
+	ParticipantSync.Cursor = NewCursor;
+	ParticipantSync.PendingParticipants = *PageParticipants;
+	ParticipantSync.NextPendingIndex = 0;
+	ParticipantSync.bPageRequestInFlight = false;
+	ParticipantSync.PageRetries = 0;
+	return true;
+}
+
+void FMixerInteractivityModule_WithSessionState::TickParticipantSync()
+{
+	if (!ParticipantSync.bActive)
+	{
+		return;
+	}
+
+	if (ParticipantSync.bPageRequestInFlight)
+	{
+		if (FPlatformTime::Seconds() - ParticipantSync.PageRequestTime > ParticipantSyncPageTimeoutSeconds)
+		{
+			if (ParticipantSync.PageRetries >= MaxParticipantSyncPageRetries)
+			{
+				UE_LOG(LogMixerInteractivity, Warning, TEXT("Participant sync abandoned after %d participants - no response from service"), ParticipantSync.ParticipantsSynced);
+				OnParticipantSyncProgress().Broadcast(ParticipantSync.ParticipantsSynced, ParticipantSync.ParticipantsTotal, true);
+				CancelParticipantSync();
+				return;
+			}
+
+			++ParticipantSync.PageRetries;
+			RequestParticipantSyncPage();
+		}
+		return;
+	}
+
+	const int32 BudgetSetting = GetDefault<UMixerInteractivitySettings>()->ParticipantSyncBudgetPerFrame;
+	const int32 Budget = BudgetSetting > 0 ? BudgetSetting : MAX_int32;
+	int32 Processed = 0;
+	while (ParticipantSync.NextPendingIndex < ParticipantSync.PendingParticipants.Num() && Processed < Budget)
+	{
+		const TSharedPtr<FJsonValue>& Participant = ParticipantSync.PendingParticipants[ParticipantSync.NextPendingIndex++];
+		const TSharedPtr<FJsonObject>* ParticipantObj;
+		if (Participant.IsValid() && Participant->TryGetObject(ParticipantObj) && SyncSingleParticipant(ParticipantObj->Get()))
+		{
+			++ParticipantSync.ParticipantsSynced;
+		}
+		++Processed;
+	}
+
+	bool bComplete = false;
+	if (ParticipantSync.NextPendingIndex >= ParticipantSync.PendingParticipants.Num())
+	{
+		ParticipantSync.PendingParticipants.Reset();
+		ParticipantSync.NextPendingIndex = 0;
+		if (ParticipantSync.bMorePages)
+		{
+			RequestParticipantSyncPage();
+		}
+		else
+		{
+			bComplete = true;
+		}
+	}
+
+	if (Processed > 0 || bComplete)
+	{
+		OnParticipantSyncProgress().Broadcast(ParticipantSync.ParticipantsSynced, FMath::Max(ParticipantSync.ParticipantsTotal, ParticipantSync.ParticipantsSynced), bComplete);
+	}
+
+	if (bComplete)
+	{
+		ParticipantSync.bActive = false;
+	}
+}
+
+void FMixerInteractivityModule_WithSessionState::RequestParticipantSyncPage()
+{
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	const FString* MethodName;
+	if (ParticipantSync.bActiveParticipantsOnly)
+	{
+		MethodName = &MixerStringConstants::MethodNames::GetActiveParticipants;
+		Params->SetNumberField(MixerStringConstants::FieldNames::Threshold, ParticipantSync.Cursor);
+	}
+	else
+	{
+		MethodName = &MixerStringConstants::MethodNames::GetAllParticipants;
+		Params->SetNumberField(MixerStringConstants::FieldNames::From, ParticipantSync.Cursor);
+	}
+
+	ParticipantSync.PageRequestTime = FPlatformTime::Seconds();
+	ParticipantSync.bPageRequestInFlight = SendParticipantSyncPageRequest(*MethodName, Params);
+	if (!ParticipantSync.bPageRequestInFlight)
+	{
+		UE_LOG(LogMixerInteractivity, Warning, TEXT("Participant sync cancelled - failed to send %s"), **MethodName);
+		CancelParticipantSync();
+	}
+}
+
+bool FMixerInteractivityModule_WithSessionState::SyncSingleParticipant(const FJsonObject* JsonObj)
+{
+	// Pages overlap at the cursor, and participants may also have joined through the
+	// regular notifications since the sync started - neither should be announced twice.
+	int32 UserId;
+	if (JsonObj->TryGetNumberField(MixerStringConstants::FieldNames::UserIdNoUnderscore, UserId) && GetCachedUser(static_cast<uint32>(UserId)).IsValid())
+	{
+		return false;
+	}
+
+	return HandleSingleParticipantChange(JsonObj, EMixerInteractivityParticipantState::Joined);
+}
+
+bool FMixerInteractivityModule_WithSessionState::ParsePropertiesFromSingleControl(FName SceneId, TSharedRef<FJsonObject> JsonObj)
+{
+	GET_JSON_STRING_RETURN_FAILURE(Kind, ControlKind);
+	GET_JSON_STRING_RETURN_FAILURE(ControlId, ControlId);
+
+	if (ControlKind == FMixerInteractiveControl::ButtonKind)
+	{
+		FMixerButtonPropertiesCached Button;
+		FString FieldValueScratch;
+		JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Text, FieldValueScratch);
+		Button.Desc.ButtonText = FText::FromString(FieldValueScratch);
+		JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Tooltip, FieldValueScratch);
+		Button.Desc.HelpText = FText::FromString(FieldValueScratch);
+		JsonObj->TryGetNumberField(MixerStringConstants::FieldNames::Cost, Button.Desc.SparkCost);
+
+		// Disabled and cooldown shouldn't be set initially
+
+		Button.State.DownCount = 0;
+		Button.State.UpCount = 0;
+		Button.State.PressCount = 0;
+		Button.State.Enabled = true;
+		Button.State.RemainingCooldown = FTimespan::Zero();
+		Button.State.Progress = 0.0f;
+		Button.SceneId = SceneId;
+
+		AddButton(*ControlId, Button);
+	}
+	else if (ControlKind == FMixerInteractiveControl::JoystickKind)
+	{
+		FMixerStickPropertiesCached Stick;
+		Stick.State.Enabled = true;
+		Stick.SceneId = SceneId;
+		AddStick(*ControlId, Stick);
+	}
+	else if (ControlKind == FMixerInteractiveControl::LabelKind)
+	{
+		FMixerLabelPropertiesCached Label;
+		Label.Desc.TextSize = 0;
+		Label.Desc.Underline = false;
+		Label.Desc.Bold = false;
+		Label.Desc.Italic = false;
+
+		FString FieldValueScratch;
+		if (JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Text, FieldValueScratch))
+		{
+			Label.Desc.Text = FText::FromString(FieldValueScratch);
+		}
+
+		if (JsonObj->TryGetStringField(MixerStringConstants::FieldNames::TextColor, FieldValueScratch))
+		{
+			Label.Desc.TextColor = FColor::FromHex(FieldValueScratch);
+		}
+		else
+		{
+			Label.Desc.TextColor = FColor::White;
+		}
+
+		JsonObj->TryGetStringField(MixerStringConstants::FieldNames::TextSize, Label.Desc.TextSize);
+		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Underline, Label.Desc.Underline);
+		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Bold, Label.Desc.Bold);
+		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Italic, Label.Desc.Italic);
+
+		Label.SceneId = SceneId;
+		AddLabel(*ControlId, Label);
+	}
+	else if (ControlKind == FMixerInteractiveControl::TextboxKind)
+	{
+		FMixerTextboxPropertiesCached Textbox;
+		JsonObj->TryGetNumberField(MixerStringConstants::FieldNames::Cost, Textbox.Desc.SparkCost);
+		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::Multiline, Textbox.Desc.Multiline);
+		JsonObj->TryGetBoolField(MixerStringConstants::FieldNames::HasSubmit, Textbox.Desc.HasSubmit);
+		FString FieldValueScratch;
+		if (JsonObj->TryGetStringField(MixerStringConstants::FieldNames::Placeholder, FieldValueScratch))
+		{
+			Textbox.Desc.Placeholder = FText::FromString(FieldValueScratch);
+		}
+		if (JsonObj->TryGetStringField(MixerStringConstants::FieldNames::SubmitText, FieldValueScratch))
+		{
+			Textbox.Desc.SubmitText = FText::FromString(FieldValueScratch);
+		}
+		Textbox.SceneId = SceneId;
+		AddTextbox(*ControlId, Textbox);
+	}
+	else
+	{
+		AddCustomControl(*ControlId, SceneId);
+		OnCustomControlPropertyUpdate().Broadcast(*ControlId, JsonObj);
+	}
+
+	return true;
+}
+
+bool FMixerInteractivityModule_WithSessionState::ApplyControlDescription(FName SceneId, TSharedRef<FJsonObject> JsonObj)
+{
+	GET_JSON_STRING_RETURN_FAILURE(Kind, ControlKind);
+	GET_JSON_STRING_RETURN_FAILURE(ControlId, ControlIdRaw);
+
+	FName ControlId = *ControlIdRaw;
+	EMixerControlKind ExistingKind;
+	if (FindControlKind(ControlId, ExistingKind))
+	{
+		// Buttons and sticks carry per-session state (press counts, cooldowns, per-participant
+		// values) that a re-parse would lose, so patch them when the kind hasn't changed.
+		// Everything else is purely descriptive and cheaper to replace outright.
+		if (ExistingKind == EMixerControlKind::Button && ControlKind == FMixerInteractiveControl::ButtonKind)
+		{
+			Buttons[ControlId].SceneId = SceneId;
+			return HandleSingleControlUpdate(ControlId, JsonObj);
+		}
+		else if (ExistingKind == EMixerControlKind::Stick && ControlKind == FMixerInteractiveControl::JoystickKind)
+		{
+			Sticks[ControlId].SceneId = SceneId;
+			return HandleSingleControlUpdate(ControlId, JsonObj);
+		}
+
+		RemoveControl(ControlId);
+	}
+
+	return ParsePropertiesFromSingleControl(SceneId, JsonObj);
+}
+
+bool FMixerInteractivityModule_WithSessionState::ApplySceneDescription(FJsonObject* JsonObj, bool bRemoveMissingControls)
+{
+	GET_JSON_STRING_RETURN_FAILURE(SceneId, SceneIdRaw);
+
+	// Scene updates that only touch scene metadata omit the control list
+	const TArray<TSharedPtr<FJsonValue>> *Controls;
+	if (!JsonObj->TryGetArrayField(MixerStringConstants::FieldNames::Controls, Controls))
+	{
+		return true;
+	}
+
+	FName SceneId = *SceneIdRaw;
+	TSet<FName> ControlsInScene;
+	for (const TSharedPtr<FJsonValue>& Control : *Controls)
+	{
+		TSharedPtr<FJsonObject> ControlObj = Control->AsObject();
+		if (ControlObj.IsValid())
+		{
+			ApplyControlDescription(SceneId, ControlObj.ToSharedRef());
+
+			FString ControlIdRaw;
+			if (bRemoveMissingControls && ControlObj->TryGetStringField(MixerStringConstants::FieldNames::ControlId, ControlIdRaw))
+			{
+				ControlsInScene.Add(*ControlIdRaw);
+			}
+		}
+	}
+
+	if (bRemoveMissingControls)
+	{
+		RemoveControlsInScene(SceneId, &ControlsInScene);
+	}
+
+	return true;
+}
+
+void FMixerInteractivityModule_WithSessionState::RemoveControlsInScene(FName SceneId, const TSet<FName>* ControlsToKeep)
+{
+	TArray<FName> ControlsToRemove;
+	auto GatherFromScene = [&](FName ControlId, FName ControlSceneId)
+	{
+		if (ControlSceneId == SceneId && (ControlsToKeep == nullptr || !ControlsToKeep->Contains(ControlId)))
+		{
+			ControlsToRemove.Add(ControlId);
+		}
+	};
+
+	for (TMap<FName, FMixerButtonPropertiesCached>::TConstIterator It(Buttons); It; ++It)
+	{
+		GatherFromScene(It->Key, It->Value.SceneId);
+	}
+	for (TMap<FName, FMixerStickPropertiesCached>::TConstIterator It(Sticks); It; ++It)
+	{
+		GatherFromScene(It->Key, It->Value.SceneId);
+	}
+	for (TMap<FName, FMixerLabelPropertiesCached>::TConstIterator It(Labels); It; ++It)
+	{
+		GatherFromScene(It->Key, It->Value.SceneId);
+	}
+	for (TMap<FName, FMixerTextboxPropertiesCached>::TConstIterator It(Textboxes); It; ++It)
+	{
+		GatherFromScene(It->Key, It->Value.SceneId);
+	}
+	for (TMap<FName, FName>::TConstIterator It(CustomControls); It; ++It)
+	{
+		GatherFromScene(It->Key, It->Value);
+	}
+
+	for (FName ControlId : ControlsToRemove)
+	{
+		RemoveControl(ControlId);
+	}
+}
+
+bool FMixerInteractivityModule_WithSessionState::HandleSceneCreateMessage(FJsonObject* JsonObj)
+{
+	GET_JSON_ARRAY_RETURN_FAILURE(Scenes, Scenes);
+	for (const TSharedPtr<FJsonValue>& Scene : *Scenes)
+	{
+		TSharedPtr<FJsonObject> SceneObj = Scene->AsObject();
+		if (SceneObj.IsValid())
+		{
+			ApplySceneDescription(SceneObj.Get(), false);
+		}
+	}
+
+	return true;
+}
+
+bool FMixerInteractivityModule_WithSessionState::HandleSceneUpdateMessage(FJsonObject* JsonObj)
+{
+	GET_JSON_ARRAY_RETURN_FAILURE(Scenes, Scenes);
+	for (const TSharedPtr<FJsonValue>& Scene : *Scenes)
+	{
+		TSharedPtr<FJsonObject> SceneObj = Scene->AsObject();
+		if (SceneObj.IsValid())
+		{
+			ApplySceneDescription(SceneObj.Get(), true);
+		}
+	}
+
+	return true;
+}
+
+bool FMixerInteractivityModule_WithSessionState::HandleSceneDeleteMessage(FJsonObject* JsonObj)
+{
+	GET_JSON_STRING_RETURN_FAILURE(SceneId, SceneIdRaw);
+	RemoveControlsInScene(*SceneIdRaw, nullptr);
+	return true;
+}
+
+bool FMixerInteractivityModule_WithSessionState::HandleControlCreateMessage(FJsonObject* JsonObj)
+{
+	GET_JSON_STRING_RETURN_FAILURE(SceneId, SceneIdRaw);
+	GET_JSON_ARRAY_RETURN_FAILURE(Controls, Controls);
+
+	FName SceneId = *SceneIdRaw;
+	for (const TSharedPtr<FJsonValue>& Control : *Controls)
+	{
+		TSharedPtr<FJsonObject> ControlObj = Control->AsObject();
+		if (ControlObj.IsValid())
+		{
+			ApplyControlDescription(SceneId, ControlObj.ToSharedRef());
+		}
+	}
+
+	return true;
+}
+
+bool FMixerInteractivityModule_WithSessionState::HandleControlDeleteMessage(FJsonObject* JsonObj)
+{
+	GET_JSON_ARRAY_RETURN_FAILURE(Controls, Controls);
+	for (const TSharedPtr<FJsonValue>& Control : *Controls)
+	{
+		FString ControlIdRaw;
+		TSharedPtr<FJsonObject> ControlObj = Control->AsObject();
+		if (ControlObj.IsValid() && ControlObj->TryGetStringField(MixerStringConstants::FieldNames::ControlId, ControlIdRaw))
+		{
+			RemoveControl(*ControlIdRaw);
+		}
+	}
+
+	return true;
+}
@@ -17,13 +17,50 @@ struct FMixerButtonPropertiesCached
 	FMixerButtonState State;
 	TSet<uint32> HoldingParticipants;
 	FName SceneId;
+
+	// FPlatformTime::Seconds() at which the current cooldown expires.
+	// State.RemainingCooldown is derived from this on read rather than maintained per frame.
+	double CooldownEndTime;
+
+	// Whether DownCount/UpCount are non-zero and the button is queued for reset at the next tick
+	bool bFrameCountersDirty;
+
+	FMixerButtonPropertiesCached()
+		: CooldownEndTime(0.0)
+		, bFrameCountersDirty(false)
+	{
+	}
+};
+
+// Per-participant stick values stored as parallel arrays so that aggregates can be
+// computed with vector math.  Participants at the center position are not stored.
+struct FMixerStickParticipantValues
+{
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Weights;
+	TArray<uint32> ParticipantIds;
+	TMap<uint32, int32> IndexByParticipant;
+
+	// Running sums for the mean reported via FMixerStickState
+	double SumX;
+	double SumY;
+
+	FMixerStickParticipantValues();
+
+	int32 Num() const { return ParticipantIds.Num(); }
+	bool Find(uint32 ParticipantId, FVector2D& OutValue) const;
+	void Set(uint32 ParticipantId, FVector2D Value, float Weight);
+	void Remove(uint32 ParticipantId);
+	void Reset();
 };
 
 struct FMixerStickPropertiesCached
 {
 	FMixerStickDescription Desc;
 	FMixerStickState State;
-	TMap<uint32, FVector2D> PerParticipantStickValue;
+	FMixerStickParticipantValues PerParticipantValues;
+	FName SceneId;
 };
 
 struct FMixerLabelPropertiesCached
@@ -35,18 +72,246 @@ struct FMixerLabelPropertiesCached
 struct FMixerTextboxPropertiesCached
 {
 	FMixerTextboxDescription Desc;
+	FName SceneId;
+};
+
+/**
+* Counts button presses as votes over a fixed or sliding time window.
+* Counts are stored per participant group, flattened as [GroupIndex * NumOptions + OptionIndex],
+* with group index 0 holding the totals over all groups.
+*/
+struct FMixerVoteTally
+{
+	FName Name;
+	TArray<FName> Options;
+	double WindowSeconds;
+	bool bSliding;
+	bool bUniqueVoters;
+
+	TMap<FName, int32> GroupIndices;
+	int32 NumGroups;
+
+	// Counts for the window in progress (fixed) or the trailing window (sliding)
+	TArray<int32> WindowCounts;
+
+	// Fixed windows only
+	TArray<int32> CompletedWindowCounts;
+	double WindowEndTime;
+	TBitArray<> VotedThisWindow;
+
+	// Sliding windows only: ring of sub-window buckets and, per voter slot, the serial of the bucket their last counted vote landed in
+	TArray<TArray<int32>> Buckets;
+	double BucketSeconds;
+	int64 CurrentBucketSerial;
+	TArray<int64> LastCountedBucketBySlot;
+
+	FMixerVoteTally();
+	void Advance(double Now);
+	int32 FindOrAddGroup(FName Group);
+	void RecordVote(int32 OptionIndex, int32 VoterSlot, FName Group, double Now);
+};
+
+/**
+* Decaying grid of click density for a single control.  Cells are stored row-major
+* so the buffer can be copied straight into a single channel float texture.
+*/
+struct FMixerHeatMap
+{
+	FBox2D Bounds;
+	int32 Width;
+	int32 Height;
+	double HalfLifeSeconds;
+	double LastDecayTime;
+	float MaxValue;
+	TArray<float> Values;
+
+	FMixerHeatMap();
+	void Decay(double Now);
+	void Accumulate(FVector2D Position);
+};
+
+enum class EMixerControlKind : uint8
+{
+	Button,
+	Stick,
+	Label,
+	Textbox,
+	Custom,
+};
+
+enum class EMixerInputEventType : uint8
+{
+	MouseDown,
+	MouseUp,
+	Move,
+	Submit,
+	Other,
+};
+
+/**
+* Precompiled lookup record for a control, allowing input to be routed
+* from the raw control id string to the cached properties in a single probe
+* without round-tripping through the global FName table.
+*/
+struct FMixerControlTableEntry
+{
+	FString RawId;
+	FName ControlId;
+	EMixerControlKind Kind;
+	int32 NextWithSameHash;
+
+	// Exactly one of these is valid for built-in kinds, none for custom controls
+	FMixerButtonPropertiesCached* Button;
+	FMixerStickPropertiesCached* Stick;
+	FMixerLabelPropertiesCached* Label;
+	FMixerTextboxPropertiesCached* Textbox;
+
+	FMixerControlTableEntry(const FString& InRawId, FName InControlId, EMixerControlKind InKind)
+		: RawId(InRawId)
+		, ControlId(InControlId)
+		, Kind(InKind)
+		, NextWithSameHash(INDEX_NONE)
+		, Button(nullptr)
+		, Stick(nullptr)
+		, Label(nullptr)
+		, Textbox(nullptr)
+	{
+	}
+};
+
+/**
+* Fixed-size, allocation-free key for a participant's session id as it appears on the
+* wire (e.g. participantID on input events).  Lets input be matched to a cached
+* participant without parsing the id into an FGuid.
+*/
+struct FMixerSessionIdKey
+{
+	// Canonical hyphenated guid length
+	static const int32 MaxLength = 36;
+
+	ANSICHAR Chars[MaxLength];
+	int32 Length;
+
+	FMixerSessionIdKey()
+		: Length(0)
+	{
+	}
+
+	/** Returns false if the raw id is too long or not ASCII, in which case the caller should fall back to FGuid parsing. */
+	template <typename CharType>
+	bool Set(const CharType* RawId, int32 RawLength)
+	{
+		if (RawLength > MaxLength)
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < RawLength; ++i)
+		{
+			const uint32 CodeUnit = static_cast<uint32>(RawId[i]);
+			if (CodeUnit >= 0x80)
+			{
+				return false;
+			}
+			Chars[i] = static_cast<ANSICHAR>(CodeUnit >= 'A' && CodeUnit <= 'Z' ? CodeUnit + ('a' - 'A') : CodeUnit);
+		}
+		Length = RawLength;
+		return true;
+	}
+
+	bool operator==(const FMixerSessionIdKey& Other) const
+	{
+		return Length == Other.Length && FMemory::Memcmp(Chars, Other.Chars, Length) == 0;
+	}
+
+	friend uint32 GetTypeHash(const FMixerSessionIdKey& Key)
+	{
+		return FCrc::MemCrc32(Key.Chars, Key.Length);
+	}
+};
+
+struct FMixerAdaptiveThrottleState
+{
+	double WindowStartTime;
+	double DispatchSecondsThisFrame;
+	double PeakDispatchSecondsPerFrame;
+	uint32 InputsThisFrame;
+	uint32 InputsThisWindow;
+	uint32 PeakInputsPerFrame;
+
+	// 0 when the controller has not yet requested an input throttle
+	uint32 CurrentBytesPerSecond;
+
+	FMixerAdaptiveThrottleState();
+};
+
+/**
+* Progress of fetching the participants that were already in the session at connection time.
+* Pages are requested one at a time and each is drained into the registry over
+* several frames before the next is requested.
+*/
+struct FMixerParticipantSyncState
+{
+	// Participants from the current page that have yet to be added to the registry
+	TArray<TSharedPtr<FJsonValue>> PendingParticipants;
+	int32 NextPendingIndex;
+
+	// Paging cursor in ms since the epoch - connectedAt of the newest participant seen,
+	// or lastInputAt when only syncing active participants
+	double Cursor;
+
+	// FPlatformTime::Seconds() at which the outstanding page was requested
+	double PageRequestTime;
+
+	int32 ParticipantsSynced;
+	int32 ParticipantsTotal;
+	int32 PageRetries;
+	bool bActive;
+	bool bActiveParticipantsOnly;
+	bool bPageRequestInFlight;
+	bool bMorePages;
+
+	FMixerParticipantSyncState();
+};
+
+/**
+* Recycles participant records between joins.  Records are handed out as shared pointers
+* whose deleter returns them here, so a record is only reused once nothing holds a strong
+* reference, and weak references taken by game code expire rather than seeing the next occupant.
+*/
+class FMixerRemoteUserPool : public TSharedFromThis<FMixerRemoteUserPool>
+{
+public:
+	~FMixerRemoteUserPool();
+
+	TSharedRef<FMixerRemoteUser> Allocate();
+
+private:
+	void Release(FMixerRemoteUser* User);
+
+	TArray<FMixerRemoteUser*> FreeUsers;
 };
 
 class FMixerInteractivityModule_WithSessionState : public FMixerInteractivityModule
 {
+public:
+	FMixerInteractivityModule_WithSessionState();
+
 public:
 	virtual void TriggerButtonCooldown(FName Button, FTimespan CooldownTime);
+	virtual bool StartVoteTally(FName TallyName, const TArray<FName>& Options, FTimespan Window, bool bSlidingWindow, bool bUniqueVoters);
+	virtual void StopVoteTally(FName TallyName);
+	virtual bool GetVoteTally(FName TallyName, FName GroupName, bool bLastCompletedWindow, TArray<int32>& OutCounts);
+	virtual bool StartHeatMap(FName Control, int32 Width, int32 Height, const FBox2D& Bounds, FTimespan HalfLife);
+	virtual void StopHeatMap(FName Control);
+	virtual bool GetHeatMap(FName Control, int32& OutWidth, int32& OutHeight, TArrayView<const float>& OutValues, float& OutMaxValue);
 	virtual bool GetButtonDescription(FName Button, FMixerButtonDescription& OutDesc);
 	virtual bool GetButtonState(FName Button, FMixerButtonState& OutState);
 	virtual bool GetButtonState(FName Button, uint32 ParticipantId, FMixerButtonState& OutState);
 	virtual bool GetStickDescription(FName Stick, FMixerStickDescription& OutDesc);
 	virtual bool GetStickState(FName Stick, FMixerStickState& OutState);
 	virtual bool GetStickState(FName Stick, uint32 ParticipantId, FMixerStickState& OutState);
+	virtual bool GetStickStatistics(FName Stick, int32 DirectionBuckets, float Percentile, FMixerStickStatistics& OutStats);
 	virtual void SetLabelText(FName Label, const FText& DisplayText);
 	virtual bool GetLabelDescription(FName Label, FMixerLabelDescription& OutDesc);
 	virtual bool GetTextboxDescription(FName Textbox, FMixerTextboxDescription& OutDesc);
@@ -67,9 +332,13 @@ protected:
 
 	void AddButton(FName ControlId, const FMixerButtonPropertiesCached& Props);
 	FMixerButtonPropertiesCached* GetButton(FName ControlId);
+	void MarkButtonFrameCountersDirty(FName ControlId, FMixerButtonPropertiesCached& Props);
+	void RecordButtonVote(FName ControlId, const FMixerRemoteUser& Participant);
+	void RecordHeatMapClick(FName ControlId, FVector2D Position);
 
 	void AddStick(FName ControlId, const FMixerStickPropertiesCached& Props);
 	FMixerStickPropertiesCached* GetStick(FName ControlId);
+	void UpdateStickParticipantValue(FMixerStickPropertiesCached& Props, const FMixerRemoteUser& Participant, FVector2D Value);
 
 	void AddLabel(FName ControlId, const FMixerLabelPropertiesCached& Props);
 	FMixerLabelPropertiesCached* GetLabel(FName ControlId);
@@ -77,21 +346,108 @@ protected:
 	void AddTextbox(FName ControlId, const FMixerTextboxPropertiesCached& Props);
 	FMixerTextboxPropertiesCached* GetTextbox(FName ControlId);
 
+	void AddCustomControl(FName ControlId, FName SceneId);
+	void RemoveControl(FName ControlId);
+	const FMixerControlTableEntry* FindControl(const TCHAR* RawControlId);
+	const FMixerControlTableEntry* FindControl(const ANSICHAR* RawControlId);
+
+	static EMixerInputEventType ParseInputEventType(const TCHAR* EventType, int32 EventTypeLength);
+	static EMixerInputEventType ParseInputEventType(const ANSICHAR* EventType, int32 EventTypeLength);
+	static bool GetInputCoordinates(const FJsonObject* InputJson, FVector2D& OutPosition);
+
 	void AddUser(TSharedPtr<FMixerRemoteUser> User);
 	void RemoveUser(TSharedPtr<FMixerRemoteUser> User);
 	void RemoveUser(FGuid ParticipantSessionId);
 	TSharedPtr<FMixerRemoteUser> GetCachedUser(uint32 ParticipantId);
 	TSharedPtr<FMixerRemoteUser> GetCachedUser(FGuid ParticipantSessionId);
+	TSharedPtr<FMixerRemoteUser> GetCachedUser(const TCHAR* RawParticipantSessionId, int32 Length);
+	TSharedPtr<FMixerRemoteUser> GetCachedUser(const ANSICHAR* RawParticipantSessionId, int32 Length);
 	void ReassignUsers(FName FromGroup, FName ToGroup);
 
+	TSharedPtr<FMixerRemoteUser> AllocateUser();
+
+	void RecordInputDispatch(double DispatchStartTime);
+
+	bool HandleSingleParticipantChange(const FJsonObject* JsonObj, EMixerInteractivityParticipantState EventType);
+
+	bool ParsePropertiesFromSingleControl(FName SceneId, TSharedRef<FJsonObject> JsonObj);
+
+	/**
+	* Incremental counterparts to the full scene parse performed at connection time.
+	* Only the controls named in the message are touched; controls that already exist
+	* with the same kind are patched in place so their runtime state survives.
+	*/
+	bool HandleSceneCreateMessage(FJsonObject* JsonObj);
+	bool HandleSceneUpdateMessage(FJsonObject* JsonObj);
+	bool HandleSceneDeleteMessage(FJsonObject* JsonObj);
+	bool HandleControlCreateMessage(FJsonObject* JsonObj);
+	bool HandleControlDeleteMessage(FJsonObject* JsonObj);
+
+	void BeginParticipantSync();
+	void CancelParticipantSync();
+	bool IsAwaitingParticipantSyncPage() const;
+
+	/**
+	* Consumes the result of a getAllParticipants/getActiveParticipants request issued via SendParticipantSyncPageRequest.
+	*
+	* @param	JsonObj		The result object of the reply
+	*
+	* @Return	false if the result was malformed.
+	*/
+	bool HandleParticipantSyncPage(const FJsonObject* JsonObj);
+
+	/**
+	* Backend-specific transport for participant sync.  The reply's result object should be
+	* passed to HandleParticipantSyncPage when it arrives.
+	*
+	* @Return	true if the request was sent.
+	*/
+	virtual bool SendParticipantSyncPageRequest(const FString& MethodName, const TSharedRef<FJsonObject> Params) = 0;
+
+private:
+	void TickAdaptiveThrottle();
+	void TickParticipantSync();
+	void RequestParticipantSyncPage();
+	bool SyncSingleParticipant(const FJsonObject* JsonObj);
+	void RebuildControlTable();
+	bool FindControlKind(FName ControlId, EMixerControlKind& OutKind) const;
+	bool ApplyControlDescription(FName SceneId, TSharedRef<FJsonObject> JsonObj);
+	bool ApplySceneDescription(FJsonObject* JsonObj, bool bRemoveMissingControls);
+	void RemoveControlsInScene(FName SceneId, const TSet<FName>* ControlsToKeep);
+	void AddControlTableEntry(FMixerControlTableEntry&& Entry);
+	void RebuildVoteRoutes();
+
 private:
 	TMap<FGuid, TSharedPtr<FMixerRemoteUser>> RemoteParticipantCacheByGuid;
 	TMap<uint32, TSharedPtr<FMixerRemoteUser>> RemoteParticipantCacheByUint;
+	TMap<FMixerSessionIdKey, TSharedPtr<FMixerRemoteUser>> RemoteParticipantCacheBySessionId;
+
+	// Outlives the module if game code holds participants past shutdown
+	TSharedRef<FMixerRemoteUserPool> ParticipantPool;
 
 	TMap<FName, FMixerButtonPropertiesCached> Buttons;
+	TArray<FName> ButtonsWithDirtyFrameCounters;
+
+	// Custom control id -> owning scene
+	TMap<FName, FName> CustomControls;
+	TArray<FMixerControlTableEntry> ControlTable;
+	TMap<uint32, int32> ControlTableIndexByHash;
+	bool bControlTableDirty;
 	TMap<FName, FMixerStickPropertiesCached> Sticks;
+	TArray<float> StickMagnitudeScratch;
 	TMap<FName, FMixerLabelPropertiesCached> Labels;
 	TMap<FName, FMixerTextboxPropertiesCached> Textboxes;
 
+	TArray<FMixerVoteTally> VoteTallies;
+	// Button -> (tally index, option index) for every tally the button votes in
+	TMap<FName, TArray<TPair<int32, int32>, TInlineAllocator<1>>> VoteRoutes;
+	// Dense per-session voter slots so unique-voter tracking can use bit arrays rather than sets
+	TMap<uint32, int32> VoterSlots;
+
+	TMap<FName, FMixerHeatMap> HeatMaps;
+
+	FMixerAdaptiveThrottleState AdaptiveThrottle;
+	FMixerParticipantSyncState ParticipantSync;
+
 	bool bPerParticipantState;
 };
@@ -14,6 +14,31 @@
 
 UMixerInteractivitySettings::UMixerInteractivitySettings()
 	: bPerParticipantStateCaching(true)
+	, MaxParticipantNotificationsPerFrame(0)
+	, bAdaptiveInputThrottling(false)
+	, AdaptiveThrottleMaxInputsPerSecond(500)
+	, AdaptiveThrottleMaxDispatchMsPerFrame(2.0f)
+	, AdaptiveThrottleMaxInputsPerFrame(100)
+	, AdaptiveThrottleMinBytesPerSecond(16 * 1024)
+	, AdaptiveThrottleMaxBytesPerSecond(1024 * 1024)
+	, bSyncParticipantsOnConnect(true)
+	, bSyncActiveParticipantsOnly(false)
+	, ActiveParticipantSyncThresholdSeconds(300)
+	, ParticipantSyncBudgetPerFrame(100)
+	, ChatHistorySize(10)
+	, ChatUserCacheSize(4096)
+	, bParseChatOffGameThread(true)
+	, ChatMessagesPerFrame(0)
+	, ChatOverloadPolicy(EMixerChatOverloadPolicy::DeliverAll)
+	, ChatCommandsPerFrame(0)
+	, MaxChatCommandArguments(8)
+	, ChatSendRatePerSecond(1.0f)
+	, ChatSendBurst(5)
+	, ChatSendQueueLimit(50)
+	, ChatSendMaxRetries(3)
+	, ChatChannelIdCacheSeconds(24.0f * 60.0f * 60.0f)
+	, ChatServerCacheSeconds(120.0f)
+	, ChatModerationAction(EMixerChatModerationAction::Mask)
 {
 
 }
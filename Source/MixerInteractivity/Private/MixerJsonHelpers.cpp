@@ -33,6 +33,17 @@ namespace MixerStringConstants
 		const FString UpdateParticipants = TEXT("updateParticipants");
 		const FString Capture = TEXT("capture");
 		const FString GetScenes = TEXT("getScenes");
+		const FString SetBandwidthThrottle = TEXT("setBandwidthThrottle");
+		const FString GiveInput = TEXT("giveInput");
+		const FString OnParticipantJoin = TEXT("onParticipantJoin");
+		const FString OnParticipantLeave = TEXT("onParticipantLeave");
+		const FString GetAllParticipants = TEXT("getAllParticipants");
+		const FString GetActiveParticipants = TEXT("getActiveParticipants");
+		const FString OnSceneCreate = TEXT("onSceneCreate");
+		const FString OnSceneUpdate = TEXT("onSceneUpdate");
+		const FString OnSceneDelete = TEXT("onSceneDelete");
+		const FString OnControlCreate = TEXT("onControlCreate");
+		const FString OnControlDelete = TEXT("onControlDelete");
 	}
 
 	namespace EventTypes
@@ -117,6 +128,23 @@ namespace MixerStringConstants
 		const FString SubmitText = TEXT("submitText");
 		const FString Groups = TEXT("groups");
 		const FString ReassignGroupId = TEXT("reassignGroupId");
+		const FString Capacity = TEXT("capacity");
+		const FString DrainRate = TEXT("drainRate");
+		const FString From = TEXT("from");
+		const FString Threshold = TEXT("threshold");
+		const FString Total = TEXT("total");
+		const FString HasMore = TEXT("hasMore");
+		const FString ReassignSceneId = TEXT("reassignSceneID");
+		const FString Url = TEXT("url");
+		const FString Pack = TEXT("pack");
+	}
+
+	namespace FragmentTypes
+	{
+		const FString Text = TEXT("text");
+		const FString Emoticon = TEXT("emoticon");
+		const FString Link = TEXT("link");
+		const FString Tag = TEXT("tag");
 	}
 
 	namespace Permissions
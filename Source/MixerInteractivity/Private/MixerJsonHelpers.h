@@ -38,6 +38,17 @@ namespace MixerStringConstants
 		extern const FString UpdateParticipants;
 		extern const FString Capture;
 		extern const FString GetScenes;
+		extern const FString SetBandwidthThrottle;
+		extern const FString GiveInput;
+		extern const FString OnParticipantJoin;
+		extern const FString OnParticipantLeave;
+		extern const FString GetAllParticipants;
+		extern const FString GetActiveParticipants;
+		extern const FString OnSceneCreate;
+		extern const FString OnSceneUpdate;
+		extern const FString OnSceneDelete;
+		extern const FString OnControlCreate;
+		extern const FString OnControlDelete;
 	}
 
 	namespace EventTypes
@@ -124,6 +135,23 @@ namespace MixerStringConstants
 		extern const FString SubmitText;
 		extern const FString Groups;
 		extern const FString ReassignGroupId;
+		extern const FString Capacity;
+		extern const FString DrainRate;
+		extern const FString From;
+		extern const FString Threshold;
+		extern const FString Total;
+		extern const FString HasMore;
+		extern const FString ReassignSceneId;
+		extern const FString Url;
+		extern const FString Pack;
+	}
+
+	namespace FragmentTypes
+	{
+		extern const FString Text;
+		extern const FString Emoticon;
+		extern const FString Link;
+		extern const FString Tag;
 	}
 
 	namespace Permissions
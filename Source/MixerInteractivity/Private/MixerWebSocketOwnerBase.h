@@ -41,14 +41,27 @@ protected:
 
 	virtual void RegisterAllServerMessageHandlers() = 0;
 
+	/**
+	* Gives the owner the chance to take over parsing of a raw server message, e.g. to move it
+	* off the game thread.  Deferred messages should later be passed, in order, to DispatchSocketMessage.
+	*
+	* @Return	true if the message has been taken.
+	*/
+	virtual bool DeferSocketMessage(const FString& MessageJsonString) { return false; }
+
+	bool DispatchSocketMessage(FJsonObject* JsonObj);
+
+	/** Id that will be assigned to the next method message sent, and hence echoed in its reply */
+	int32 GetNextMessageId() const		{ return MessageId; }
+
+	bool IsSocketConnected() const		{ return WebSocket.IsValid() && WebSocket->IsConnected(); }
+
 private:
 	void OnSocketConnected();
 	void OnSocketConnectionError(const FString& ErrorMessage);
 	void OnSocketMessage(const FString& MessageJsonString);
 	void OnSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
 
-	bool OnSocketMessage(FJsonObject* JsonObj);
-
 	typedef TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>> CondensedWriterType;
 
 	TSharedRef<CondensedWriterType> StartMethodMessage(const FString& MethodName, FString& PayloadString);
@@ -239,12 +252,17 @@ void TMixerWebSocketOwnerBase<T>::OnSocketMessage(const FString& MessageJsonStri
 {
 	UE_LOG(LogMixerInteractivity, Verbose, TEXT("WebSocket message %s"), *MessageJsonString);
 
+	if (DeferSocketMessage(MessageJsonString))
+	{
+		return;
+	}
+
 	bool bHandled = false;
 	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(MessageJsonString);
 	TSharedPtr<FJsonObject> JsonObj;
 	if (FJsonSerializer::Deserialize(JsonReader, JsonObj) && JsonObj.IsValid())
 	{
-		bHandled = OnSocketMessage(JsonObj.Get());
+		bHandled = DispatchSocketMessage(JsonObj.Get());
 	}
 
 	if (!bHandled)
@@ -264,7 +282,7 @@ void TMixerWebSocketOwnerBase<T>::OnSocketClosed(int32 StatusCode, const FString
 }
 
 template <class T>
-bool TMixerWebSocketOwnerBase<T>::OnSocketMessage(FJsonObject* JsonObj)
+bool TMixerWebSocketOwnerBase<T>::DispatchSocketMessage(FJsonObject* JsonObj)
 {
 	bool bHandled = false;
 	GET_JSON_STRING_RETURN_FAILURE(Type, MessageType);
@@ -13,6 +13,22 @@
 #include "MixerInteractivityTypes.h"
 #include "MixerInteractivityUserSettings.h"
 #include "MixerChatConnection.h"
+#include "MixerChatDiscovery.h"
+#include "MixerChatModerationFilter.h"
+#include "MixerChatWordListAsset.h"
+#include "MixerInteractivitySettings.h"
+
+FOnlineChatMixer::FOnlineChatMixer()
+	: DiscoveryCache(MakeShared<FMixerChatDiscoveryCache>())
+	, bModerationFilterLoaded(false)
+{
+	WordListChangedHandle = UMixerChatWordListAsset::OnWordListChanged.AddRaw(this, &FOnlineChatMixer::OnWordListChanged);
+}
+
+FOnlineChatMixer::~FOnlineChatMixer()
+{
+	UMixerChatWordListAsset::OnWordListChanged.Remove(WordListChangedHandle);
+}
 
 bool FOnlineChatMixer::CreateRoom(const FUniqueNetId& UserId, const FChatRoomId& RoomId, const FString& Nickname, const FChatRoomConfig& ChatRoomConfig)
 {
@@ -43,6 +59,11 @@ bool FOnlineChatMixer::JoinPublicRoom(const FUniqueNetId& UserId, const FChatRoo
 
 		TSharedPtr<const FMixerLocalUser> CurrentUser = IMixerInteractivityModule::Get().GetCurrentUser();
 		check(CurrentUser.IsValid());
+		if (CurrentUser->GetChannel().Id != 0)
+		{
+			// Saves a round trip to look up our own channel
+			DiscoveryCache->SeedChannelId(CurrentUser->Name, CurrentUser->GetChannel().Id);
+		}
 		NewConnection = DefaultChatConnection = MakeShared<FMixerChatConnection>(this, UserId, CurrentUser->Name, ChatRoomConfig);
 	}
 	else
@@ -187,6 +208,159 @@ bool FOnlineChatMixer::GetLastMessages(const FUniqueNetId& UserId, const FChatRo
 	}
 }
 
+bool FOnlineChatMixer::ForEachLastMessage(const FUniqueNetId& UserId, const FChatRoomId& RoomId, int32 NumMessages, TFunctionRef<void(const FChatMessageMixer&)> Visitor)
+{
+	TSharedPtr<FMixerChatConnection> Connection = FindConnectionForRoomId(RoomId);
+	if (Connection.IsValid())
+	{
+		Connection->ForEachMessageInHistory(NumMessages, Visitor);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+bool FOnlineChatMixer::RequestOlderMessages(const FUniqueNetId& UserId, const FChatRoomId& RoomId, int32 NumMessages)
+{
+	TSharedPtr<FMixerChatConnection> Connection = FindConnectionForRoomId(RoomId);
+	return Connection.IsValid() && Connection->RequestOlderHistory(NumMessages);
+}
+
+bool FOnlineChatMixer::GetUserCacheStats(const FUniqueNetId& UserId, const FChatRoomId& RoomId, FMixerChatUserCacheStats& OutStats)
+{
+	TSharedPtr<FMixerChatConnection> Connection = FindConnectionForRoomId(RoomId);
+	if (Connection.IsValid())
+	{
+		Connection->GetUserCacheStats(OutStats);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+bool FOnlineChatMixer::RegisterChatCommand(const FString& Command, FTimespan PerUserCooldown, FTimespan CommandCooldown, const FOnMixerChatCommand& Handler)
+{
+	return CommandRouter.RegisterCommand(Command, PerUserCooldown, CommandCooldown, Handler);
+}
+
+bool FOnlineChatMixer::UnregisterChatCommand(const FString& Command)
+{
+	return CommandRouter.UnregisterCommand(Command);
+}
+
+bool FOnlineChatMixer::StartChatVote(const FUniqueNetId& UserId, const FChatRoomId& RoomId, const TArray<FString>& Options, bool bConsumeVoteMessages)
+{
+	TSharedPtr<FMixerChatConnection> Connection = FindConnectionForRoomId(RoomId);
+	if (Connection.IsValid())
+	{
+		Connection->StartChatVote(Options, bConsumeVoteMessages);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+bool FOnlineChatMixer::GetChatVoteTally(const FUniqueNetId& UserId, const FChatRoomId& RoomId, TArray<int32>& OutVotes)
+{
+	TSharedPtr<FMixerChatConnection> Connection = FindConnectionForRoomId(RoomId);
+	return Connection.IsValid() && Connection->GetChatVoteTally(OutVotes);
+}
+
+bool FOnlineChatMixer::StopChatVote(const FUniqueNetId& UserId, const FChatRoomId& RoomId)
+{
+	TSharedPtr<FMixerChatConnection> Connection = FindConnectionForRoomId(RoomId);
+	return Connection.IsValid() && Connection->StopChatVote();
+}
+
+bool FOnlineChatMixer::SendRoomAnnouncement(const FUniqueNetId& UserId, const FChatRoomId& RoomId, FName Key, const FString& MsgBody)
+{
+	TSharedPtr<FMixerChatConnection> Connection = FindConnectionForRoomId(RoomId);
+	return Connection.IsValid() && Connection->SendAnnouncement(Key, MsgBody);
+}
+
+bool FOnlineChatMixer::GetSendQueueStats(const FUniqueNetId& UserId, const FChatRoomId& RoomId, FMixerChatSendQueueStats& OutStats)
+{
+	TSharedPtr<FMixerChatConnection> Connection = FindConnectionForRoomId(RoomId);
+	if (Connection.IsValid())
+	{
+		Connection->GetSendQueueStats(OutStats);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+void FOnlineChatMixer::SetModerationWordList(const TArray<FString>& Words, bool bMatchWholeWords)
+{
+	const bool bMaskMatches = GetDefault<UMixerInteractivitySettings>()->ChatModerationAction == EMixerChatModerationAction::Mask;
+	TSharedPtr<const FMixerChatModerationFilter, ESPMode::ThreadSafe> NewFilter;
+	if (Words.Num() > 0)
+	{
+		NewFilter = MakeShared<FMixerChatModerationFilter, ESPMode::ThreadSafe>(Words, bMatchWholeWords, bMaskMatches);
+		UE_LOG(LogMixerChat, Log, TEXT("Chat moderation filter built with %d words"), NewFilter->GetNumWords());
+	}
+
+	ModerationFilter = NewFilter;
+	bModerationFilterLoaded = true;
+
+	// Rooms already joined switch over from their next message
+	if (DefaultChatConnection.IsValid())
+	{
+		DefaultChatConnection->SetModerationFilter(ModerationFilter);
+	}
+	for (TSharedRef<FMixerChatConnection>& Connection : AdditionalChatConnections)
+	{
+		Connection->SetModerationFilter(ModerationFilter);
+	}
+}
+
+TSharedPtr<const FMixerChatModerationFilter, ESPMode::ThreadSafe> FOnlineChatMixer::GetModerationFilter()
+{
+	if (!bModerationFilterLoaded)
+	{
+		const FSoftObjectPath& WordListPath = GetDefault<UMixerInteractivitySettings>()->ChatModerationWordList;
+		if (WordListPath.IsValid())
+		{
+			UMixerChatWordListAsset* WordList = Cast<UMixerChatWordListAsset>(WordListPath.TryLoad());
+			if (WordList != nullptr)
+			{
+				SetModerationWordList(WordList->Words, WordList->bMatchWholeWords);
+			}
+			else
+			{
+				UE_LOG(LogMixerChat, Warning, TEXT("Failed to load chat moderation word list %s.  Chat will not be filtered."), *WordListPath.ToString());
+			}
+		}
+
+		// Set last, so that the change notification from the asset's own PostLoad is ignored
+		bModerationFilterLoaded = true;
+	}
+
+	return ModerationFilter;
+}
+
+void FOnlineChatMixer::OnWordListChanged(UMixerChatWordListAsset* WordList)
+{
+	// Before first use there is nothing to update; the list will be read when it is needed
+	if (bModerationFilterLoaded && FSoftObjectPath(WordList) == GetDefault<UMixerInteractivitySettings>()->ChatModerationWordList)
+	{
+		SetModerationWordList(WordList->Words, WordList->bMatchWholeWords);
+	}
+}
+
+void FOnlineChatMixer::RouteChatCommand(const FChatRoomId& RoomId, const TSharedRef<FChatMessageMixerImpl>& Message)
+{
+	CommandRouter.RouteMessage(RoomId, Message);
+}
+
 bool FOnlineChatMixer::IsMessageFromLocalUser(const FUniqueNetId& UserId, const FChatMessage& Message, const bool bIncludeExternalInstances)
 {
 	return UserId == *Message.GetUserId();
@@ -12,6 +12,7 @@
 #include "OnlineChatMixer.h"
 #include "MixerInteractivityTypes.h"
 #include "Misc/Guid.h"
+#include "MixerChatCommandRouter.h"
 
 class FUniqueNetIdMixer : public FUniqueNetId
 {
@@ -85,74 +86,198 @@ private:
 	TSharedRef<const FUniqueNetId> NetId;
 };
 
+/**
+* Storage for the fragments of a chat message: a single character buffer holding the
+* strings of every fragment, plus a small descriptor per fragment indexing into it.
+*/
+struct FMixerChatMessageContent
+{
+public:
+	FMixerChatMessageContent()
+		: TotalTextLength(0)
+	{
+	}
+
+	void AddFragment(EMixerChatFragmentType Type, const FString& Text, const FString& Data, int32 UserId)
+	{
+		FFragment& Fragment = Fragments[Fragments.AddUninitialized()];
+		Fragment.Type = Type;
+		Fragment.TextStart = Chars.Num();
+		Fragment.TextLength = Text.Len();
+		Chars.Append(*Text, Text.Len());
+		Fragment.DataStart = Chars.Num();
+		Fragment.DataLength = Data.Len();
+		Chars.Append(*Data, Data.Len());
+		Fragment.UserId = UserId;
+		TotalTextLength += Text.Len();
+	}
+
+	int32 Num() const						{ return Fragments.Num(); }
+	int32 GetTotalTextLength() const		{ return TotalTextLength; }
+
+	FMixerChatMessageFragment GetFragment(int32 Index) const
+	{
+		const FFragment& Fragment = Fragments[Index];
+		FMixerChatMessageFragment Result;
+		Result.Type = Fragment.Type;
+		if (Fragment.TextLength > 0)
+		{
+			Result.Text = &Chars[Fragment.TextStart];
+			Result.TextLength = Fragment.TextLength;
+		}
+		if (Fragment.DataLength > 0)
+		{
+			Result.Data = &Chars[Fragment.DataStart];
+			Result.DataLength = Fragment.DataLength;
+		}
+		Result.UserId = Fragment.UserId;
+		return Result;
+	}
+
+	EMixerChatFragmentType GetFragmentType(int32 Index) const		{ return Fragments[Index].Type; }
+
+	/** For in-place edits that preserve length, such as masking */
+	TArrayView<TCHAR> GetMutableFragmentText(int32 Index)
+	{
+		const FFragment& Fragment = Fragments[Index];
+		return Fragment.TextLength > 0 ? TArrayView<TCHAR>(&Chars[Fragment.TextStart], Fragment.TextLength) : TArrayView<TCHAR>();
+	}
+
+	TArrayView<TCHAR> GetMutableFragmentData(int32 Index)
+	{
+		const FFragment& Fragment = Fragments[Index];
+		return Fragment.DataLength > 0 ? TArrayView<TCHAR>(&Chars[Fragment.DataStart], Fragment.DataLength) : TArrayView<TCHAR>();
+	}
+
+	void AppendTextTo(FString& Out) const
+	{
+		for (const FFragment& Fragment : Fragments)
+		{
+			if (Fragment.TextLength > 0)
+			{
+				Out.AppendChars(&Chars[Fragment.TextStart], Fragment.TextLength);
+			}
+		}
+	}
+
+	void Empty()
+	{
+		Chars.Empty();
+		Fragments.Empty();
+		TotalTextLength = 0;
+	}
+
+	void Reserve(int32 NumFragments, int32 NumChars)
+	{
+		Fragments.Reserve(NumFragments);
+		Chars.Reserve(NumChars);
+	}
+
+private:
+	struct FFragment
+	{
+		EMixerChatFragmentType Type;
+		int32 TextStart;
+		int32 TextLength;
+		int32 DataStart;
+		int32 DataLength;
+		int32 UserId;
+	};
+
+	TArray<TCHAR> Chars;
+	TArray<FFragment> Fragments;
+	int32 TotalTextLength;
+};
+
 struct FChatMessageMixerImpl : public FChatMessageMixer
 {
 public:
-	FChatMessageMixerImpl(const FGuid& InMessageId, TSharedRef<const FMixerChatUser> InFromUser)
+	FChatMessageMixerImpl(const FGuid& InMessageId, TSharedRef<const FMixerChatUser> InFromUser, FMixerChatMessageContent&& InContent)
 		: MessageId(InMessageId)
 		, FromUser(InFromUser)
+		, Content(MoveTemp(InContent))
 		, Timestamp(FDateTime::Now())
+		, bBodyBuilt(false)
 		, bIsWhisper(false)
 		, bIsAction(false)
 		, bIsModerated(false)
+		, bIsFiltered(false)
 	{
 	}
 
 	// FChatMessage methods
 	virtual const TSharedRef<const FUniqueNetId>& GetUserId() const override	{ return FromUser->GetUserId(); }
 	virtual const FString& GetNickname() const override							{ return FromUser->Name; }
-	virtual const FString& GetBody() const override								{ return Body; }
+	virtual const FString& GetBody() const override
+	{
+		// Most messages are only ever consumed as fragments or not at all, so the flat body is built on demand
+		if (!bBodyBuilt)
+		{
+			const int32 PrefixLength = bIsAction ? FromUser->Name.Len() + 1 : 0;
+			Body.Reset(PrefixLength + Content.GetTotalTextLength());
+			if (bIsAction)
+			{
+				Body += FromUser->Name;
+				Body += TEXT(' ');
+			}
+			Content.AppendTextTo(Body);
+			bBodyBuilt = true;
+		}
+		return Body;
+	}
 	virtual const FDateTime& GetTimestamp() const override						{ return Timestamp; }
 
 	// FChatMessageMixer methods
 	virtual bool IsWhisper()const override										{ return bIsWhisper; }
 	virtual bool IsAction() const override										{ return bIsAction; }
 	virtual bool IsModerated() const override									{ return bIsModerated; }
+	virtual bool IsFiltered() const override									{ return bIsFiltered; }
+	virtual int32 GetNumFragments() const override								{ return bIsModerated ? 0 : Content.Num(); }
+	virtual FMixerChatMessageFragment GetFragment(int32 Index) const override	{ return bIsModerated ? FMixerChatMessageFragment() : Content.GetFragment(Index); }
 
-	const FMixerChatUser& GetSender()											{ return FromUser.Get(); }
-	const FGuid& GetMessageId()													{ return MessageId; }
+	const FMixerChatUser& GetSender() const										{ return FromUser.Get(); }
+	const FGuid& GetMessageId() const											{ return MessageId; }
 
 	void FlagAsDeleted()
 	{
-		Body.Empty();
+		// Fragments handed out earlier point into the content (and the body may have been read), so
+		// both keep their storage until the message goes away.  A deleted message just reports neither.
+		Body.Reset();
+		bBodyBuilt = true;
 		bIsModerated = true;
 	}
 
-	void AppendBodyFragment(const FString& InBodyFragment)
+	void FlagAsWhisper()
 	{
-		Body += InBodyFragment;
+		bIsWhisper = true;
 	}
 
-	void FlagAsWhisper()
+	void FlagAsFiltered()
 	{
-		bIsWhisper = true;
+		bIsFiltered = true;
 	}
 
 	void FlagAsAction()
 	{
 		if (!bIsAction)
 		{
+			// The sender's name is prefixed when the body is built rather than copying it here
 			bIsAction = true;
-			Body = FromUser->Name + TEXT(" ") + Body;
+			bBodyBuilt = false;
 		}
 	}
 
 private:
 	FGuid MessageId;
 	TSharedRef<const FMixerChatUser> FromUser;
-	FString Body;
+	FMixerChatMessageContent Content;
+	mutable FString Body;
 	FDateTime Timestamp;
+	mutable bool bBodyBuilt;
 	bool bIsWhisper;
 	bool bIsAction;
 	bool bIsModerated;
-
-public:
-	// Intrusive list to avoid double allocation for chat history
-	// Would be nice to use TIntrusiveList, but that doesn't support
-	// TSharedPtr as the link type, and IOnlineChat enforces that the
-	// lifetime is managed by TSharedPtr
-	TSharedPtr<FChatMessageMixerImpl> NextLink;
-	TSharedPtr<FChatMessageMixerImpl> PrevLink;
+	bool bIsFiltered;
 };
 
 struct FChatPollMixerImpl : public FChatPollMixer
@@ -197,6 +322,9 @@ private:
 class FOnlineChatMixer : public IOnlineChatMixer, public TSharedFromThis<FOnlineChatMixer>
 {
 public:
+	FOnlineChatMixer();
+	virtual ~FOnlineChatMixer();
+
 	virtual bool CreateRoom(const FUniqueNetId& UserId, const FChatRoomId& RoomId, const FString& Nickname, const FChatRoomConfig& ChatRoomConfig) override;
 
 	virtual bool ConfigureRoom(const FUniqueNetId& UserId, const FChatRoomId& RoomId, const FChatRoomConfig& ChatRoomConfig) override { return false; }
@@ -230,8 +358,23 @@ public:
 	// IOnlineChatMixer
 	virtual bool StartPoll(const FUniqueNetId& UserId, const FChatRoomId& RoomId, const FString& Question, const TArray<FString>& Answers, FTimespan Duration) override;
 	virtual bool VoteInPoll(const FUniqueNetId& UserId, const FChatRoomId& RoomId, const FChatPollMixer& Poll, int32 AnswerIndex) override;
+	virtual bool ForEachLastMessage(const FUniqueNetId& UserId, const FChatRoomId& RoomId, int32 NumMessages, TFunctionRef<void(const FChatMessageMixer&)> Visitor) override;
+	virtual bool RequestOlderMessages(const FUniqueNetId& UserId, const FChatRoomId& RoomId, int32 NumMessages) override;
+
+	virtual bool GetUserCacheStats(const FUniqueNetId& UserId, const FChatRoomId& RoomId, FMixerChatUserCacheStats& OutStats) override;
+	virtual bool RegisterChatCommand(const FString& Command, FTimespan PerUserCooldown, FTimespan CommandCooldown, const FOnMixerChatCommand& Handler) override;
+	virtual bool UnregisterChatCommand(const FString& Command) override;
+	virtual bool StartChatVote(const FUniqueNetId& UserId, const FChatRoomId& RoomId, const TArray<FString>& Options, bool bConsumeVoteMessages) override;
+	virtual bool GetChatVoteTally(const FUniqueNetId& UserId, const FChatRoomId& RoomId, TArray<int32>& OutVotes) override;
+	virtual bool StopChatVote(const FUniqueNetId& UserId, const FChatRoomId& RoomId) override;
+	virtual bool SendRoomAnnouncement(const FUniqueNetId& UserId, const FChatRoomId& RoomId, FName Key, const FString& MsgBody) override;
+	virtual bool GetSendQueueStats(const FUniqueNetId& UserId, const FChatRoomId& RoomId, FMixerChatSendQueueStats& OutStats) override;
+	virtual void SetModerationWordList(const TArray<FString>& Words, bool bMatchWholeWords) override;
 
 public:
+	void RouteChatCommand(const FChatRoomId& RoomId, const TSharedRef<FChatMessageMixerImpl>& Message);
+	TSharedRef<class FMixerChatDiscoveryCache> GetDiscoveryCache() const { return DiscoveryCache; }
+	TSharedPtr<const class FMixerChatModerationFilter, ESPMode::ThreadSafe> GetModerationFilter();
 	void ConnectAttemptFinished(const FUniqueNetId& UserId, const FChatRoomId& RoomId, bool bSuccess, const FString& ErrorMessage);
 	bool ExitRoomWithReason(const FUniqueNetId& UserId, const FChatRoomId& RoomId, bool bIsClean, const FString& Reason);
 
@@ -243,6 +386,8 @@ private:
 
 	TSharedPtr<class FMixerChatConnection> FindConnectionForRoomId(const FChatRoomId& RoomId);
 
+	void OnWordListChanged(class UMixerChatWordListAsset* WordList);
+
 	/**
 	* Connection to the default chat channel for the current Mixer session -
 	* that is, the channel owned by the current Mixer user.
@@ -251,4 +396,17 @@ private:
 
 	/** Connection to additional chat channels that we may want to interact with. */
 	TArray<TSharedRef<class FMixerChatConnection>> AdditionalChatConnections;
+
+	FMixerChatCommandRouter CommandRouter;
+
+	/** Channel ids and chat endpoints shared by all connections */
+	TSharedRef<class FMixerChatDiscoveryCache> DiscoveryCache;
+
+	/**
+	* Compiled from the word list asset in project settings on first use, and rebuilt
+	* whenever that asset changes.  Shared with every connection's ingest path.
+	*/
+	TSharedPtr<const class FMixerChatModerationFilter, ESPMode::ThreadSafe> ModerationFilter;
+	bool bModerationFilterLoaded;
+	FDelegateHandle WordListChangedHandle;
 };
\ No newline at end of file
@@ -0,0 +1,50 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#pragma once
+
+#include "Engine/DataAsset.h"
+#include "MixerChatWordListAsset.generated.h"
+
+class UMixerChatWordListAsset;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMixerChatWordListChanged, UMixerChatWordListAsset* /*WordList*/);
+
+/**
+* Words and phrases to be filtered out of incoming Mixer chat.  Select the list to use
+* in the Chat section of the Mixer Interactivity project settings.
+*/
+UCLASS()
+class MIXERINTERACTIVITY_API UMixerChatWordListAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UMixerChatWordListAsset();
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+public:
+	/** Words or phrases to match.  Matching ignores case. */
+	UPROPERTY(EditAnywhere, Category = "Moderation")
+	TArray<FString> Words;
+
+	/**
+	* Only match entries that are not part of a longer word, i.e. where the characters either
+	* side of the match are not letters or digits.  Otherwise entries match anywhere.
+	*/
+	UPROPERTY(EditAnywhere, Category = "Moderation")
+	bool bMatchWholeWords;
+
+	/** Broadcast when a word list is loaded or edited, so that chat filtering can pick up the change. */
+	static FOnMixerChatWordListChanged OnWordListChanged;
+};
@@ -21,6 +21,7 @@ public:
 	* Interval (seconds) at which instances of this control are checked for updates.
 	* During an update pass changed properties that are flagged as client-writable
 	* will be batched up and transmitted to the Mixer Interactive service.
+	* All instances sharing an interval are checked in the same pass.
 	*/
 	UPROPERTY(EditAnywhere, Category="Property Replication", meta=(UIMin=0, ClampMin=0))
 	float ClientPropertyUpdateInterval;
@@ -41,6 +42,8 @@ protected:
 	* be transmitted to the server.  If this collection is non-empty the control
 	* instance will be ticked every ClientPropertyUpdateInterval seconds.
 	* Default implementation collects all properties that are BlueprintReadWrite.
+	* Called for each instance.  The result is compiled into a plan that is shared
+	* between instances of the class for as long as they return the same properties.
 	*
 	* @param	OutProperties		Out parameter to be filled with UProperty instances for which updates should be sent client->server
 	*/
@@ -69,6 +72,6 @@ private:
 	void InitClientWrittenPropertyMaintenance();
 
 private:
-	TArray<UProperty*> ClientWritableProperties;
+	TSharedPtr<const struct FMixerCustomControlDiffPlan> DiffPlan;
 	TArray<uint8> LastSentPropertyData;
 };
\ No newline at end of file
@@ -27,12 +27,62 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FMixerStickEventDynamicDelegate, F
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMixerBroadcastingEventDynamicDelegate);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FMixerTextSubmittedEventDynamicDelegate, FMixerTextboxReference, Textbox, int32, ParticipantId, FText, SubmittedText, FMixerTransactionId, TransactionId, int32, SparkCost);
 
+// Batched variants - fire at most once per control per frame with all the input received for that control during the frame.
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FMixerButtonBatchEventDynamicDelegate, FMixerButtonReference, Button, const TArray<int32>&, ParticipantIds, const TArray<FMixerTransactionId>&, TransactionIds, const TArray<int32>&, SparkCosts);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FMixerStickBatchEventDynamicDelegate, FMixerStickReference, Joystick, const TArray<int32>&, ParticipantIds, const TArray<FVector2D>&, StickValues);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FMixerTextSubmittedBatchEventDynamicDelegate, FMixerTextboxReference, Textbox, const TArray<int32>&, ParticipantIds, const TArray<FText>&, SubmittedTexts, const TArray<FMixerTransactionId>&, TransactionIds, const TArray<int32>&, SparkCosts);
+
 // Note: these are for 'simple' custom controls only.  UObject-style controls get these events via method calls.
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FMixerCustomControlInputDynamicDelegate, FMixerCustomControlReference, Control, FName, Event, int32, ParticipantId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMixerCustomControlUpdateDynamicDelegate, FMixerCustomControlReference, Control);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMixerCustomMethodStubDelegate);
 
+/** Button input accumulated during a frame for delivery via FMixerButtonBatchEventDynamicDelegate */
+struct FMixerButtonEventBatch
+{
+	TArray<int32> ParticipantIds;
+	TArray<FMixerTransactionId> TransactionIds;
+	TArray<int32> SparkCosts;
+
+	void Reset()
+	{
+		ParticipantIds.Reset();
+		TransactionIds.Reset();
+		SparkCosts.Reset();
+	}
+};
+
+/** Stick input accumulated during a frame for delivery via FMixerStickBatchEventDynamicDelegate */
+struct FMixerStickEventBatch
+{
+	TArray<int32> ParticipantIds;
+	TArray<FVector2D> StickValues;
+
+	void Reset()
+	{
+		ParticipantIds.Reset();
+		StickValues.Reset();
+	}
+};
+
+/** Textbox input accumulated during a frame for delivery via FMixerTextSubmittedBatchEventDynamicDelegate */
+struct FMixerTextSubmittedEventBatch
+{
+	TArray<int32> ParticipantIds;
+	TArray<FText> SubmittedTexts;
+	TArray<FMixerTransactionId> TransactionIds;
+	TArray<int32> SparkCosts;
+
+	void Reset()
+	{
+		ParticipantIds.Reset();
+		SubmittedTexts.Reset();
+		TransactionIds.Reset();
+		SparkCosts.Reset();
+	}
+};
+
 USTRUCT()
 struct MIXERINTERACTIVITY_API FMixerButtonEventDynamicDelegateWrapper
 {
@@ -44,9 +94,18 @@ struct MIXERINTERACTIVITY_API FMixerButtonEventDynamicDelegateWrapper
 	UPROPERTY()
 	FMixerButtonEventDynamicDelegate ReleasedDelegate;
 
+	UPROPERTY()
+	FMixerButtonBatchEventDynamicDelegate PressedBatchDelegate;
+
+	UPROPERTY()
+	FMixerButtonBatchEventDynamicDelegate ReleasedBatchDelegate;
+
+	FMixerButtonEventBatch PendingPressed;
+	FMixerButtonEventBatch PendingReleased;
+
 	bool IsBound()
 	{
-		return PressedDelegate.IsBound() || ReleasedDelegate.IsBound();
+		return PressedDelegate.IsBound() || ReleasedDelegate.IsBound() || PressedBatchDelegate.IsBound() || ReleasedBatchDelegate.IsBound();
 	}
 };
 
@@ -58,9 +117,14 @@ struct MIXERINTERACTIVITY_API FMixerStickEventDynamicDelegateWrapper
 	UPROPERTY()
 	FMixerStickEventDynamicDelegate Delegate;
 
+	UPROPERTY()
+	FMixerStickBatchEventDynamicDelegate BatchDelegate;
+
+	FMixerStickEventBatch Pending;
+
 	bool IsBound()
 	{
-		return Delegate.IsBound();
+		return Delegate.IsBound() || BatchDelegate.IsBound();
 	}
 };
 
@@ -72,9 +136,14 @@ struct MIXERINTERACTIVITY_API FMixerTextboxEventDynamicDelegateWrapper
 	UPROPERTY()
 	FMixerTextSubmittedEventDynamicDelegate SubmittedDelegate;
 
+	UPROPERTY()
+	FMixerTextSubmittedBatchEventDynamicDelegate SubmittedBatchDelegate;
+
+	FMixerTextSubmittedEventBatch Pending;
+
 	bool IsBound()
 	{
-		return SubmittedDelegate.IsBound();
+		return SubmittedDelegate.IsBound() || SubmittedBatchDelegate.IsBound();
 	}
 };
 
@@ -148,6 +217,9 @@ public:
 public:
 	FMixerButtonEventDynamicDelegate* GetButtonEvent(FName ButtonName, bool Pressed);
 	FMixerStickEventDynamicDelegate* GetStickEvent(FName StickName);
+	FMixerButtonBatchEventDynamicDelegate* GetButtonBatchEvent(FName ButtonName, bool Pressed);
+	FMixerStickBatchEventDynamicDelegate* GetStickBatchEvent(FName StickName);
+	FMixerTextSubmittedBatchEventDynamicDelegate* GetTextSubmittedBatchEvent(FName TextboxName);
 	FMixerCustomControlInputDynamicDelegate& GetCustomControlInputEvent(FName ControlName);
 	FMixerCustomControlUpdateDynamicDelegate& GetCustomControlUpdateEvent(FName ControlName);
 	void AddCustomMethodBinding(FName EventName, UObject* TargetObject, FName TargetFunctionName);
@@ -164,6 +236,9 @@ public:
 	void OnCustomControlPropertyUpdateNativeEvent(FName ControlName, const TSharedRef<FJsonObject> UpdatedProperties);
 	void OnTextboxSubmitNativeEvent(FName TextboxName, TSharedPtr<const FMixerRemoteUser> Participant, const FMixerTextboxEventDetails& Details);
 
+	/** Deliver input accumulated this frame to batched events.  Called once per frame by the event router. */
+	void FlushBatchedEvents();
+
 #if WITH_EDITORONLY_DATA
 	void RefreshCustomControls();
 	void OnCustomControlCompiled(class UBlueprint* CompiledBP);
@@ -171,6 +246,7 @@ public:
 
 	virtual UWorld* GetWorld() const override;
 	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
 
 	UMixerCustomControl* GetMappedCustomControl(FName ControlName);
 	TSharedPtr<FJsonObject> GetUnmappedCustomControl(FName ControlName);
@@ -196,8 +272,16 @@ public:
 	static UMixerInteractivityBlueprintEventSource* GetBlueprintEventSource(UWorld* ForWorld);
 
 	void RegisterForMixerEvents();
+	bool IsRegisteredForMixerEvents() const { return bRegisteredForMixerEvents; }
 private:
-	static TArray<TWeakObjectPtr<UMixerInteractivityBlueprintEventSource>> BlueprintEventSources;
+	void MarkBatchPending(TArray<FName>& PendingNames, FName ControlName);
+
+	bool bRegisteredForMixerEvents;
+
+	/** Controls with batched input waiting for FlushBatchedEvents */
+	TArray<FName> PendingButtonBatches;
+	TArray<FName> PendingStickBatches;
+	TArray<FName> PendingTextboxBatches;
 
 };
 
@@ -214,6 +298,9 @@ struct FMixerButtonEventBinding
 
 	UPROPERTY()
 	bool Pressed;
+
+	UPROPERTY()
+	bool bBatched;
 };
 
 UENUM()
@@ -222,6 +309,8 @@ enum class EMixerGenericEventBindingType : uint8
 	Stick,
 	CustomMethod,
 	TextSubmitted,
+	StickBatch,
+	TextSubmittedBatch,
 };
 
 USTRUCT()
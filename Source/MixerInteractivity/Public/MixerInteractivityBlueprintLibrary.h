@@ -286,6 +286,72 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity", Meta=(AdvancedDisplay = "7"))
 	static void GetButtonState(FMixerButtonReference Button, FTimespan& RemainingCooldown, float& Progress, int32& DownCount, int32& PressCount, int32& UpCount, bool& Enabled, int32 ParticipantId = 0);
 
+	/**
+	* Begin counting presses of a set of buttons as votes.  Starting a tally with the name of an existing one replaces it.
+	*
+	* @param	TallyName		Name used to query or stop the tally.
+	* @param	Options			Buttons whose presses count as votes, in the order counts are reported.
+	* @param	Window			Length of the counting window.
+	* @param	SlidingWindow	If true, counts cover the most recent Window of time.  Otherwise counts reset at the end of each consecutive fixed window.
+	* @param	UniqueVoters	If true, only a participant's first vote (for any option) within a window is counted.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Mixer|Interactivity")
+	static void StartVoteTally(FName TallyName, const TArray<FMixerButtonReference>& Options, FTimespan Window, bool SlidingWindow, bool UniqueVoters = true);
+
+	/**
+	* Stop and discard a vote tally.
+	*
+	* @param	TallyName		Name of the tally to stop.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Mixer|Interactivity")
+	static void StopVoteTally(FName TallyName);
+
+	/**
+	* Retrieve the current counts for a vote tally.
+	*
+	* @param	TallyName			Name of the tally.
+	* @param	Counts				One count per option, in the order the options were supplied.
+	* @param	LeadingOption		Index of the option with the most votes, or -1 if there are no votes.
+	* @param	Group				If provided, only votes from participants in this group are reported.
+	* @param	LastCompletedWindow	For fixed window tallies, report the final counts of the most recently completed window rather than the one in progress.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity", Meta = (AdvancedDisplay = "3"))
+	static void GetVoteTally(FName TallyName, TArray<int32>& Counts, int32& LeadingOption, FMixerGroupReference Group, bool LastCompletedWindow = false);
+
+	/**
+	* Begin accumulating click positions on a button or custom control into a decaying 2D heat map.
+	* Starting a heat map for a control that already has one replaces it.
+	*
+	* @param	Control			Name of the button or custom control.
+	* @param	Width			Number of grid cells along X.
+	* @param	Height			Number of grid cells along Y.
+	* @param	BoundsMin		Minimum control coordinates covered by the grid.
+	* @param	BoundsMax		Maximum control coordinates covered by the grid.  Clicks outside the bounds are ignored.
+	* @param	HalfLife		Time taken for accumulated heat to decay by half.  Zero disables decay.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Mixer|Interactivity")
+	static void StartHeatMap(FName Control, int32 Width, int32 Height, FVector2D BoundsMin, FVector2D BoundsMax, FTimespan HalfLife);
+
+	/**
+	* Stop and discard a heat map.
+	*
+	* @param	Control			Name of the control whose heat map should be stopped.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Mixer|Interactivity")
+	static void StopHeatMap(FName Control);
+
+	/**
+	* Retrieve the current contents of a heat map.
+	*
+	* @param	Control			Name of the control whose heat map should be returned.
+	* @param	Width			Number of grid cells along X.
+	* @param	Height			Number of grid cells along Y.
+	* @param	Values			Grid cells, row-major (Width x Height).
+	* @param	MaxValue		Largest value in the grid, for normalization.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity")
+	static void GetHeatMap(FName Control, int32& Width, int32& Height, TArray<float>& Values, float& MaxValue);
+
 	/**
 	* Retrieve information about a joystick that is independent of its current state.
 	*
@@ -307,6 +373,23 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Mixer|Interactivity", Meta = (AdvancedDisplay = "4"))
 	static void GetStickState(FMixerStickReference Stick, float& XAxis, float& YAxis, bool& Enabled, int32 ParticipantId = 0);
 
+	/**
+	* Compute aggregate statistics over the current state of a joystick for all participants.
+	* Requires per-participant state caching.
+	*
+	* @param	Stick					Reference to the joystick for which statistics should be computed.
+	* @param	ActiveParticipants		Number of participants currently holding the joystick away from the center.
+	* @param	Mean					Mean position over active participants [-1,1]
+	* @param	Variance				Per-axis variance of position over active participants.
+	* @param	LevelWeightedMean		Mean position over active participants, weighted by participant level.
+	* @param	DirectionHistogram		Number of active participants pushing in each direction.  Bucket 0 is centered on +X, subsequent buckets proceed towards +Y.
+	* @param	MagnitudeAtPercentile	Magnitude of the joystick position at the requested percentile of active participants.
+	* @param	DirectionBuckets		Number of buckets in the direction histogram (e.g. 8 or 16).
+	* @param	Percentile				Percentile [0,1] of participants at which the joystick magnitude should be sampled.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Mixer|Interactivity", Meta = (AdvancedDisplay = "7"))
+	static void GetStickStatistics(FMixerStickReference Stick, int32& ActiveParticipants, FVector2D& Mean, FVector2D& Variance, FVector2D& LevelWeightedMean, TArray<int32>& DirectionHistogram, float& MagnitudeAtPercentile, int32 DirectionBuckets = 8, float Percentile = 0.5f);
+
 	/**
 	* Change the text that will be displayed to remote users on a label.
 	*
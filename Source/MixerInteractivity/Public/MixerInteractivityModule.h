@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Modules/ModuleManager.h"
+#include "Containers/ArrayView.h"
 
 struct FMixerUser;
 struct FMixerLocalUser;
@@ -19,6 +20,7 @@ struct FMixerButtonDescription;
 struct FMixerButtonState;
 struct FMixerStickDescription;
 struct FMixerStickState;
+struct FMixerStickStatistics;
 struct FMixerLabelDescription;
 struct FMixerTextboxDescription;
 struct FMixerButtonEventDetails;
@@ -29,6 +31,7 @@ class FJsonObject;
 enum class EMixerLoginState : uint8;
 enum class EMixerInteractivityParticipantState : uint8;
 enum class EMixerInteractivityState : uint8;
+enum class EMixerInteractivityThrottle : uint8;
 
 /**
 * Interface for Mixer Interactivity features.
@@ -189,6 +192,77 @@ public:
 	*/
 	virtual bool GetButtonState(FName Button, uint32 ParticipantId, FMixerButtonState& OutState) = 0;
 
+	/**
+	* Begin counting presses of a set of buttons as votes.  Each button is one option;
+	* counts are kept both overall and per participant group.  Starting a tally with the
+	* name of an existing one replaces it.
+	*
+	* @param	TallyName		Name used to query or stop the tally.
+	* @param	Options			Buttons whose presses count as votes, in the order counts are reported.
+	* @param	Window			Length of the counting window.
+	* @param	bSlidingWindow	If true, counts cover the most recent Window of time.  Otherwise counts reset at the end of each consecutive fixed window.
+	* @param	bUniqueVoters	If true, only a participant's first vote (for any option) within a window is counted.
+	*
+	* @Return					True if the tally was started.
+	*/
+	virtual bool StartVoteTally(FName TallyName, const TArray<FName>& Options, FTimespan Window, bool bSlidingWindow, bool bUniqueVoters) = 0;
+
+	/**
+	* Stop and discard a vote tally started via StartVoteTally.
+	*
+	* @param	TallyName		Name of the tally to stop.
+	*/
+	virtual void StopVoteTally(FName TallyName) = 0;
+
+	/**
+	* Retrieve the current counts for a vote tally.
+	*
+	* @param	TallyName				Name of the tally.
+	* @param	GroupName				If not NAME_None, only votes from participants in this group are reported.
+	* @param	bLastCompletedWindow	For fixed window tallies, report the final counts of the most recently completed window rather than the one in progress.
+	* @param	OutCounts				Out parameter filled in with one count per option, in the order the options were supplied.
+	*
+	* @Return							True if the tally was found and OutCounts is valid.
+	*/
+	virtual bool GetVoteTally(FName TallyName, FName GroupName, bool bLastCompletedWindow, TArray<int32>& OutCounts) = 0;
+
+	/**
+	* Begin accumulating the positions of clicks on a button or custom control into a decaying 2D heat map.
+	* Button presses that carry coordinates are counted, as is any custom control input with numeric x and y members.
+	* Starting a heat map for a control that already has one replaces it.
+	*
+	* @param	Control			Name of the button or custom control.
+	* @param	Width			Number of grid cells along X.
+	* @param	Height			Number of grid cells along Y.
+	* @param	Bounds			Region of control coordinates covered by the grid.  Clicks outside it are ignored.
+	* @param	HalfLife		Time taken for accumulated heat to decay by half.  Zero disables decay.
+	*
+	* @Return					True if the heat map was started.
+	*/
+	virtual bool StartHeatMap(FName Control, int32 Width, int32 Height, const FBox2D& Bounds, FTimespan HalfLife) = 0;
+
+	/**
+	* Stop and discard a heat map started via StartHeatMap.
+	*
+	* @param	Control			Name of the control whose heat map should be stopped.
+	*/
+	virtual void StopHeatMap(FName Control) = 0;
+
+	/**
+	* Retrieve the current contents of a heat map.  Values are row-major, Width x Height,
+	* suitable for direct upload to a single channel float texture.  The view remains valid
+	* until the next tick of the module or until the heat map is stopped.
+	*
+	* @param	Control			Name of the control whose heat map should be returned.
+	* @param	OutWidth		Out parameter filled in with the number of grid cells along X.
+	* @param	OutHeight		Out parameter filled in with the number of grid cells along Y.
+	* @param	OutValues		Out parameter filled in with a view of the grid cells.
+	* @param	OutMaxValue		Out parameter filled in with the largest value in the grid, for normalization.
+	*
+	* @Return					True if the heat map was found and the out parameters are valid.
+	*/
+	virtual bool GetHeatMap(FName Control, int32& OutWidth, int32& OutHeight, TArrayView<const float>& OutValues, float& OutMaxValue) = 0;
+
 	/**
 	* Retrieve information about a named joystick that is independent of its current state.
 	* See FMixerStickDescription for details.
@@ -225,6 +299,19 @@ public:
 	*/
 	virtual bool GetStickState(FName Stick, uint32 ParticipantId, FMixerStickState& OutState) = 0;
 
+	/**
+	* Compute aggregate statistics over the current per-participant state of a named joystick.
+	* See FMixerStickStatistics for details.  Requires per-participant state caching.
+	*
+	* @param	Stick				Name of the joystick for which statistics should be computed.
+	* @param	DirectionBuckets	Number of buckets in the direction histogram (e.g. 8 or 16).  Pass 0 to skip the histogram.
+	* @param	Percentile			Percentile [0,1] of participants at which the stick magnitude should be sampled.
+	* @param	OutStats			Out parameter filled in with statistics for the joystick upon success.
+	*
+	* @Return						True if joystick was found and OutStats is valid.
+	*/
+	virtual bool GetStickStatistics(FName Stick, int32 DirectionBuckets, float Percentile, FMixerStickStatistics& OutStats) = 0;
+
 	/**
 	* Change the text that will be displayed to remote users on the named label.
 	*
@@ -344,6 +431,21 @@ public:
 
 	virtual void CallRemoteMethod(const FString& MethodName, const TSharedRef<FJsonObject> MethodParams) = 0;
 
+	/**
+	* Limit the bandwidth the Mixer service may use when sending a category of messages to this client.
+	* Messages beyond the limit are dropped by the service rather than queued.  May be used to shed load
+	* before it reaches the game thread when a large audience is participating.
+	* Note: when adaptive input throttling is enabled in UMixerInteractivitySettings the input throttle
+	* is managed automatically and explicit values may be overwritten.
+	*
+	* @param	ThrottleType	Category of server messages to which the throttle applies.
+	* @param	MaxBytes		Maximum burst size (in bytes) the service will send before throttling.
+	* @param	BytesPerSecond	Rate (in bytes per second) at which the burst allowance is replenished.
+	*
+	* @Return					True if the throttle request was sent to the service.
+	*/
+	virtual bool SetBandwidthThrottle(EMixerInteractivityThrottle ThrottleType, uint32 MaxBytes, uint32 BytesPerSecond) = 0;
+
 	/**
 	* Get access to Mixer chat via UE's standard IOnlineChat interface.
 	* Sending messages requires a logged in user.
@@ -371,6 +473,23 @@ public:
 	DECLARE_EVENT_TwoParams(IMixerInteractivityModule, FOnParticipantStateChangedEvent, TSharedPtr<const FMixerRemoteUser>, EMixerInteractivityParticipantState);
 	virtual FOnParticipantStateChangedEvent& OnParticipantStateChanged() = 0;
 
+	/**
+	* Batched counterpart to OnParticipantStateChanged.  Fires once for each run of participants that
+	* underwent the same state change together (e.g. a raid bringing in many viewers at once) rather than
+	* once per participant.  The view is only valid for the duration of the broadcast.
+	*/
+	DECLARE_EVENT_TwoParams(IMixerInteractivityModule, FOnParticipantsChangedEvent, TArrayView<const TSharedPtr<const FMixerRemoteUser>>, EMixerInteractivityParticipantState);
+	virtual FOnParticipantsChangedEvent& OnParticipantsChanged() = 0;
+
+	/**
+	* Reports progress fetching participants who were already in the session when the
+	* connection was established.  Participants are streamed into the registry over several
+	* frames and announced through OnParticipantStateChanged/OnParticipantsChanged as joins.
+	* Parameters are the number synced so far, the total reported by the service, and whether the sync has finished.
+	*/
+	DECLARE_EVENT_ThreeParams(IMixerInteractivityModule, FOnParticipantSyncProgressEvent, int32, int32, bool);
+	virtual FOnParticipantSyncProgressEvent& OnParticipantSyncProgress() = 0;
+
 	DECLARE_EVENT_ThreeParams(IMixerInteractivityModule, FOnButtonEvent, FName, TSharedPtr<const FMixerRemoteUser>, const FMixerButtonEventDetails&);
 	virtual FOnButtonEvent& OnButtonEvent() = 0;
 
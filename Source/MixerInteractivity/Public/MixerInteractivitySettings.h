@@ -28,6 +28,29 @@ struct FMixerPredefinedGroup
 	FName InitialScene;
 };
 
+UENUM()
+enum class EMixerChatOverloadPolicy : uint8
+{
+	/** Hold back messages over the per-frame budget and deliver them on later frames. */
+	DeliverAll,
+
+	/** Deliver an evenly spaced sample of the backlog, up to the budget.  Remaining messages are only added to history. */
+	Sample,
+
+	/** Deliver messages up to the budget individually and the remainder of the backlog together via OnChatRoomMessageDigest. */
+	Coalesce,
+};
+
+UENUM()
+enum class EMixerChatModerationAction : uint8
+{
+	/** Leave the text as sent and report the match via FChatMessageMixer::IsFiltered. */
+	Flag,
+
+	/** Replace matched text with '*' as well as reporting the match. */
+	Mask,
+};
+
 UCLASS(config=Game, defaultconfig)
 class MIXERINTERACTIVITY_API UMixerInteractivitySettings : public UObject
 {
@@ -110,6 +133,140 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Interactive Controls", AdvancedDisplay, meta = (DisplayName = "Track built-in control state per remote participant"))
 	bool bPerParticipantStateCaching;
 
+	/**
+	* Maximum number of participant join/leave/update notifications delivered to game code
+	* per frame.  Additional notifications are queued and delivered over subsequent frames,
+	* smoothing out the cost of large spikes such as raids.  0 delivers all notifications immediately.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (ClampMin = 0))
+	int32 MaxParticipantNotificationsPerFrame;
+
+	/**
+	* Allow the plugin to automatically tighten or relax the bandwidth the Mixer service
+	* uses to send participant input, based on the observed input rate and the cost of
+	* dispatching input on the game thread.  This causes the service to drop excess
+	* input during audience spikes rather than delivering it to the title.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (DisplayName = "Adaptive input throttling"))
+	bool bAdaptiveInputThrottling;
+
+	/** Input events per second above which the adaptive controller will tighten the input throttle. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (EditCondition = "bAdaptiveInputThrottling", ClampMin = 1))
+	int32 AdaptiveThrottleMaxInputsPerSecond;
+
+	/** Game thread time (in milliseconds) spent dispatching input in a single frame above which the input throttle will be tightened. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (EditCondition = "bAdaptiveInputThrottling", ClampMin = 0.1))
+	float AdaptiveThrottleMaxDispatchMsPerFrame;
+
+	/** Number of input events drained in a single frame above which the input throttle will be tightened. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (EditCondition = "bAdaptiveInputThrottling", ClampMin = 1))
+	int32 AdaptiveThrottleMaxInputsPerFrame;
+
+	/** Lowest input bandwidth (bytes per second) the adaptive controller will request from the service. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (EditCondition = "bAdaptiveInputThrottling", ClampMin = 1))
+	int32 AdaptiveThrottleMinBytesPerSecond;
+
+	/** Highest input bandwidth (bytes per second) the adaptive controller will request from the service. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (EditCondition = "bAdaptiveInputThrottling", ClampMin = 1))
+	int32 AdaptiveThrottleMaxBytesPerSecond;
+
+	/**
+	* Fetch participants who were already in the session when the game connected, rather than
+	* only learning about participants as they join.  Participants are requested in pages and
+	* added to the registry over several frames.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay)
+	bool bSyncParticipantsOnConnect;
+
+	/** Only fetch participants who have recently given input, rather than every participant in the session. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (EditCondition = "bSyncParticipantsOnConnect"))
+	bool bSyncActiveParticipantsOnly;
+
+	/** How recently (in seconds) a participant must have given input to be fetched when only syncing active participants. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (EditCondition = "bSyncActiveParticipantsOnly", ClampMin = 1))
+	int32 ActiveParticipantSyncThresholdSeconds;
+
+	/** Maximum number of fetched participants added to the registry per frame.  0 adds each page as soon as it arrives. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (EditCondition = "bSyncParticipantsOnConnect", ClampMin = 0))
+	int32 ParticipantSyncBudgetPerFrame;
+
+	/**
+	* Number of recent messages retained per chat room and available via GetLastMessages.
+	* Storage for this many messages is reserved when a room is joined.  0 disables chat history.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 0, ClampMax = 10000))
+	int32 ChatHistorySize;
+
+	/**
+	* Number of chat users remembered per room before the least recently active are forgotten.
+	* Users referenced by chat history or an active poll are always kept.  A forgotten user who
+	* chats again is not reported as joining again unless as many other users have been forgotten
+	* since.  0 remembers every user for the life of the room.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 0))
+	int32 ChatUserCacheSize;
+
+	/**
+	* Parse incoming chat traffic on a worker thread.  Parsed messages are handed back to
+	* the game thread and delivered in order at the next tick.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay)
+	bool bParseChatOffGameThread;
+
+	/** Maximum number of room chat messages delivered to game code per frame.  0 delivers all messages as soon as they are parsed. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (EditCondition = "bParseChatOffGameThread", ClampMin = 0))
+	int32 ChatMessagesPerFrame;
+
+	/** How to handle room chat messages beyond the per-frame budget. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (EditCondition = "bParseChatOffGameThread"))
+	EMixerChatOverloadPolicy ChatOverloadPolicy;
+
+	/** Maximum number of chat command handlers called per frame.  Remaining commands wait for later frames.  0 for no limit. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 0))
+	int32 ChatCommandsPerFrame;
+
+	/** Maximum number of arguments split out of a chat command.  Any further words are left in the final argument. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 1, ClampMax = 64))
+	int32 MaxChatCommandArguments;
+
+	/** Sustained rate at which chat messages are sent to each room.  Messages beyond this are queued. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 0.01))
+	float ChatSendRatePerSecond;
+
+	/** Number of chat messages that may be sent to a room in a burst before ChatSendRatePerSecond applies. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 1))
+	int32 ChatSendBurst;
+
+	/** Maximum number of outgoing chat messages queued per room.  When full, the oldest lowest priority message is dropped. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 1))
+	int32 ChatSendQueueLimit;
+
+	/** Number of times an outgoing chat message rejected by the server (e.g. for sending too fast) is retried. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 0))
+	int32 ChatSendMaxRetries;
+
+	/** How long the id of a chat channel looked up by name is remembered. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 0))
+	float ChatChannelIdCacheSeconds;
+
+	/**
+	* How long chat endpoints and authkey for a channel are remembered, allowing a room
+	* to be rejoined without repeating discovery.  Rejected authkeys are refreshed automatically.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", AdvancedDisplay, meta = (ClampMin = 0))
+	float ChatServerCacheSeconds;
+
+	/**
+	* Words and phrases to filter out of incoming chat.  Matching runs as chat is parsed, at a cost
+	* that does not depend on the size of the list.  Edits to the list apply to rooms already joined.
+	*/
+	UPROPERTY(EditAnywhere, Config, Category = "Chat", meta = (AllowedClasses = "MixerChatWordListAsset"))
+	FSoftObjectPath ChatModerationWordList;
+
+	/** What to do with incoming chat messages that match the moderation word list. */
+	UPROPERTY(EditAnywhere, Config, Category = "Chat")
+	EMixerChatModerationAction ChatModerationAction;
+
 public:
 	FString GetResolvedRedirectUri() const
 	{
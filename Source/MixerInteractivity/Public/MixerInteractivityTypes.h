@@ -195,6 +195,40 @@ struct FMixerStickState
 	bool Enabled;
 };
 
+/** Aggregate statistics over the per-participant state of a joystick */
+struct FMixerStickStatistics
+{
+	/** Number of participants currently holding the joystick away from the center */
+	int32 ActiveParticipants;
+
+	/** Mean position over active participants [-1,1] */
+	FVector2D Mean;
+
+	/** Per-axis variance of position over active participants */
+	FVector2D Variance;
+
+	/** Mean position over active participants, with each participant weighted by their level (minimum 1) */
+	FVector2D LevelWeightedMean;
+
+	/**
+	* Number of active participants pushing the joystick in each direction.
+	* Bucket 0 is centered on +X, subsequent buckets proceed towards +Y.
+	*/
+	TArray<int32> DirectionHistogram;
+
+	/** Magnitude of the joystick position at the requested percentile of active participants */
+	float MagnitudeAtPercentile;
+
+	FMixerStickStatistics()
+		: ActiveParticipants(0)
+		, Mean(0, 0)
+		, Variance(0, 0)
+		, LevelWeightedMean(0, 0)
+		, MagnitudeAtPercentile(0)
+	{
+	}
+};
+
 /** Additional information about a button event */
 struct FMixerButtonEventDetails
 {
@@ -210,6 +244,20 @@ struct FMixerButtonEventDetails
 
 	/** Whether the button event represents a press (true) or release (false) */
 	bool Pressed;
+
+	/** Position of the click on the button, as reported by the client.  Only valid if bHasCoordinates is set. */
+	FVector2D Coordinates;
+
+	/** Whether the client included the position of the click with this event */
+	bool bHasCoordinates;
+
+	FMixerButtonEventDetails()
+		: SparkCost(0)
+		, Pressed(false)
+		, Coordinates(0, 0)
+		, bHasCoordinates(false)
+	{
+	}
 };
 
 /** Additional information about a textbox event */
@@ -292,4 +340,20 @@ enum class EMixerInteractivityState : uint8
 	Interactivity_Stopping,
 };
 
+/** Categories of server to client interactive messages that may be independently throttled */
+enum class EMixerInteractivityThrottle : uint8
+{
+	/** All messages sent by the service on this interactive session */
+	Global,
+
+	/** Input from remote participants (button presses, joystick movement, etc.) */
+	Input,
+
+	/** Notifications of remote participants joining the interactive session */
+	ParticipantJoin,
+
+	/** Notifications of remote participants leaving the interactive session */
+	ParticipantLeave,
+};
+
 static const FName NAME_DefaultMixerParticipantGroup = "default";
\ No newline at end of file
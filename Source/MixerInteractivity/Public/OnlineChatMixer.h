@@ -11,6 +11,52 @@
 
 #include "Interfaces/OnlineChatInterface.h"
 
+/** Kinds of content a Mixer chat message may be made up of */
+enum class EMixerChatFragmentType : uint8
+{
+	/** Plain text */
+	Text,
+
+	/** An emoticon.  Data is the name of the emoticon pack. */
+	Emoticon,
+
+	/** A hyperlink.  Data is the url. */
+	Link,
+
+	/** A mention of another user.  Data is their user name and UserId their Mixer id. */
+	Tag,
+
+	/** A fragment type not recognized by this plugin.  Only Text is available. */
+	Other,
+};
+
+/**
+* One piece of a Mixer chat message.  Strings are not null terminated and point
+* into storage owned by the message, so must not outlive it.
+*/
+struct FMixerChatMessageFragment
+{
+	EMixerChatFragmentType Type;
+	const TCHAR* Text;
+	int32 TextLength;
+	const TCHAR* Data;
+	int32 DataLength;
+	int32 UserId;
+
+	FMixerChatMessageFragment()
+		: Type(EMixerChatFragmentType::Text)
+		, Text(TEXT(""))
+		, TextLength(0)
+		, Data(TEXT(""))
+		, DataLength(0)
+		, UserId(0)
+	{
+	}
+
+	FString GetText() const { return FString(TextLength, Text); }
+	FString GetData() const { return FString(DataLength, Data); }
+};
+
 /**
 * Implementation of FChatMessage for messages received via Mixer.
 * See FChatMessage for interface method details.
@@ -26,6 +72,98 @@ public:
 
 	/** Check whether a moderator has removed this message after it was originally sent */
 	virtual bool IsModerated() const = 0;
+
+	/**
+	* Check whether this message matched the chat moderation word list.  Depending on project settings
+	* the matched text may also have been masked.
+	*/
+	virtual bool IsFiltered() const = 0;
+
+	/** Get the number of fragments (text, emoticons, links, user tags) that make up this message */
+	virtual int32 GetNumFragments() const = 0;
+
+	/**
+	* Get one of the fragments that make up this message.  Concatenating the text of all
+	* fragments gives the same result as GetBody, other than for actions which are prefixed
+	* with the sender's name.
+	*/
+	virtual FMixerChatMessageFragment GetFragment(int32 Index) const = 0;
+};
+
+/**
+* Delegate used when a chat command registered with IOnlineChatMixer::RegisterChatCommand is received
+*
+* @param RoomId room that the command was sent to
+* @param Message the message containing the command
+* @param Arguments whitespace separated words following the command.  Only valid for the duration of the call.
+*/
+DECLARE_DELEGATE_ThreeParams(FOnMixerChatCommand, const FChatRoomId& /*RoomId*/, const FChatMessageMixer& /*Message*/, TArrayView<const FString> /*Arguments*/);
+
+/** Snapshot of the state of a chat room's outgoing message queue */
+struct FMixerChatSendQueueStats
+{
+	/** Messages waiting to be sent */
+	int32 NumQueued;
+
+	/** Messages sent and awaiting acknowledgement from the server */
+	int32 NumInFlight;
+
+	/** Messages acknowledged by the server */
+	int32 NumSent;
+
+	/** Sends that were rejected by the server and queued again */
+	int32 NumRetried;
+
+	/** Messages given up on, either because the queue was full or retries were exhausted */
+	int32 NumDropped;
+
+	/** Announcements replaced by a newer announcement with the same key before being sent */
+	int32 NumCoalesced;
+
+	FMixerChatSendQueueStats()
+		: NumQueued(0)
+		, NumInFlight(0)
+		, NumSent(0)
+		, NumRetried(0)
+		, NumDropped(0)
+		, NumCoalesced(0)
+	{
+	}
+};
+
+/** Snapshot of the memory used by a chat room's cache of users */
+struct FMixerChatUserCacheStats
+{
+	/** Users currently cached */
+	int32 NumUsers;
+
+	/** Cached users that cannot be evicted because they are still referenced by history, a poll or game code */
+	int32 NumPinnedUsers;
+
+	/** Configured maximum number of users.  NumUsers may exceed this if all are pinned. 0 means unbounded. */
+	int32 Capacity;
+
+	/** Approximate bytes held by the user objects themselves */
+	SIZE_T UserBytes;
+
+	/** Bytes held by the cache's own bookkeeping */
+	SIZE_T OverheadBytes;
+
+	int32 NumEvictions;
+	int32 NumHits;
+	int32 NumMisses;
+
+	FMixerChatUserCacheStats()
+		: NumUsers(0)
+		, NumPinnedUsers(0)
+		, Capacity(0)
+		, UserBytes(0)
+		, OverheadBytes(0)
+		, NumEvictions(0)
+		, NumHits(0)
+		, NumMisses(0)
+	{
+	}
 };
 
 /** Represents a vote taking place in a Mixer channel*/
@@ -62,6 +200,16 @@ public:
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnChatRoomMessagesCleared, const FUniqueNetId& /*UserId*/, const FChatRoomId& /*RoomId*/);
 typedef FOnChatRoomMessagesCleared::FDelegate FOnChatRoomMessagesClearedDelegate;
 
+/**
+* Delegate used when a room's message history has been (re)loaded from the server, e.g. after
+* joining or in response to IOnlineChatMixer::RequestOlderMessages
+*
+* @param UserId user currently in the room
+* @param RoomId room whose history was loaded
+*/
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnChatRoomHistoryLoaded, const FUniqueNetId& /*UserId*/, const FChatRoomId& /*RoomId*/);
+typedef FOnChatRoomHistoryLoaded::FDelegate FOnChatRoomHistoryLoadedDelegate;
+
 /**
 * Delegate used when a user is purged from a chat room (all messages deleted)
 *
@@ -72,6 +220,17 @@ typedef FOnChatRoomMessagesCleared::FDelegate FOnChatRoomMessagesClearedDelegate
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnChatRoomUserPurged, const FUniqueNetId& /*UserId*/, const FChatRoomId& /*RoomId*/, const FUniqueNetId& /*PurgedId*/);
 typedef FOnChatRoomUserPurged::FDelegate FOnChatRoomUserPurgedDelegate;
 
+/**
+* Delegate used when room chat messages arriving faster than the configured per-frame budget
+* are delivered together rather than individually (see UMixerInteractivitySettings::ChatOverloadPolicy)
+*
+* @param UserId user currently in the room
+* @param RoomId room that the messages were sent to
+* @param ChatMessages the coalesced messages, oldest first
+*/
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnChatRoomMessageDigest, const FUniqueNetId& /*UserId*/, const FChatRoomId& /*RoomId*/, const TArray<TSharedRef<FChatMessage>>& /*ChatMessages*/);
+typedef FOnChatRoomMessageDigest::FDelegate FOnChatRoomMessageDigestDelegate;
+
 /**
 * Delegate used when a poll starts in a Mixer chat channel
 *
@@ -138,8 +297,143 @@ public:
 	*/
 	virtual bool VoteInPoll(const FUniqueNetId& UserId, const FChatRoomId& RoomId, const FChatPollMixer& Poll, int32 AnswerIndex) = 0;
 
+	/**
+	* Visit the most recent messages in a room's history, newest first, without copying them.
+	* Use GetLastMessages instead if references to the messages need to be kept.
+	*
+	* @param UserId			id of the user in the room
+	* @param RoomId			id of the room whose history should be visited.  For Mixer chat this is the owning user name.
+	* @param NumMessages	maximum number of messages to visit, or -1 for the whole history.
+	* @param Visitor		function called for each message.  Must not join, leave or send to the room.
+	*
+	* @return				whether or not the room was found.
+	*/
+	virtual bool ForEachLastMessage(const FUniqueNetId& UserId, const FChatRoomId& RoomId, int32 NumMessages, TFunctionRef<void(const FChatMessageMixer&)> Visitor) = 0;
+
+	/**
+	* Fetch messages older than those currently held in a room's history.  The room's history grows
+	* to hold them; OnChatRoomHistoryLoaded fires once they have been merged in.  The service can
+	* return at most the 100 most recent messages, so paging cannot go back further than that.
+	*
+	* @param UserId			id of the user in the room
+	* @param RoomId			id of the room.  For Mixer chat this is the owning user name.
+	* @param NumMessages	number of additional older messages wanted.
+	*
+	* @return				whether or not a request was sent.
+	*/
+	virtual bool RequestOlderMessages(const FUniqueNetId& UserId, const FChatRoomId& RoomId, int32 NumMessages) = 0;
+
+	/**
+	* Get memory statistics for the cache of users seen in a room.
+	*
+	* @param UserId			id of the user in the room
+	* @param RoomId			id of the room.  For Mixer chat this is the owning user name.
+	* @param OutStats		filled in with the current statistics.
+	*
+	* @return				whether or not the room was found.
+	*/
+	virtual bool GetUserCacheStats(const FUniqueNetId& UserId, const FChatRoomId& RoomId, FMixerChatUserCacheStats& OutStats) = 0;
+
+	/**
+	* Register a handler for chat messages that begin with a command word, e.g. "!attack left".
+	* Commands are matched case-insensitively in every joined room, and handlers are called in
+	* batches at the start of the next frame (see UMixerInteractivitySettings::ChatCommandsPerFrame).
+	* Uses that arrive while the command is cooling down are ignored.
+	*
+	* @param Command			the command word, including any prefix character.  May not contain whitespace.
+	* @param PerUserCooldown	minimum time between uses of the command by any one user.
+	* @param CommandCooldown	minimum time between uses of the command by anyone.
+	* @param Handler			called with the arguments following the command.
+	*
+	* @return					whether or not the command was registered.  Registering an existing command replaces its handler.
+	*/
+	virtual bool RegisterChatCommand(const FString& Command, FTimespan PerUserCooldown, FTimespan CommandCooldown, const FOnMixerChatCommand& Handler) = 0;
+
+	/**
+	* Stop handling a command previously registered with RegisterChatCommand.
+	*
+	* @param Command			the command word passed at registration.
+	*
+	* @return					whether or not the command was registered.
+	*/
+	virtual bool UnregisterChatCommand(const FString& Command) = 0;
+
+	/**
+	* Start counting chat messages in a room as votes, without involving the Mixer poll service.
+	* A message is a vote if its first word is one of the options (case-insensitive) or an option's
+	* 1-based number.  Only each user's first vote counts.  Votes are counted as chat is parsed, so
+	* this stays cheap for the game thread regardless of chat volume.  Starting a new vote discards
+	* any previous one in the room.
+	*
+	* @param UserId					id of the user in the room
+	* @param RoomId					id of the room.  For Mixer chat this is the owning user name.
+	* @param Options				the options that may be voted for.
+	* @param bConsumeVoteMessages	if true, messages that are votes are not delivered as chat or kept in history.
+	*
+	* @return						whether or not the room was found.
+	*/
+	virtual bool StartChatVote(const FUniqueNetId& UserId, const FChatRoomId& RoomId, const TArray<FString>& Options, bool bConsumeVoteMessages) = 0;
+
+	/**
+	* Get the current number of votes for each option of a vote started with StartChatVote.
+	*
+	* @param UserId			id of the user in the room
+	* @param RoomId			id of the room.  For Mixer chat this is the owning user name.
+	* @param OutVotes		filled in with one count per option, in the order they were passed to StartChatVote.
+	*
+	* @return				whether or not there is a vote in progress in the room.
+	*/
+	virtual bool GetChatVoteTally(const FUniqueNetId& UserId, const FChatRoomId& RoomId, TArray<int32>& OutVotes) = 0;
+
+	/**
+	* Stop counting votes in a room.  Read the final tally with GetChatVoteTally first if needed.
+	*
+	* @param UserId			id of the user in the room
+	* @param RoomId			id of the room.  For Mixer chat this is the owning user name.
+	*
+	* @return				whether or not there was a vote in progress in the room.
+	*/
+	virtual bool StopChatVote(const FUniqueNetId& UserId, const FChatRoomId& RoomId) = 0;
+
+	/**
+	* Send a game-generated message to a room at low priority.  If an announcement with the same key
+	* is still waiting to be sent it is replaced, so rapidly changing state (e.g. a score) does not
+	* flood the room.  Like other outgoing chat this is subject to the room's send rate limit.
+	*
+	* @param UserId			id of the user sending the message
+	* @param RoomId			id of the room.  For Mixer chat this is the owning user name.
+	* @param Key			identifies announcements that supersede each other.  NAME_None never coalesces.
+	* @param MsgBody		text of the message.
+	*
+	* @return				whether or not the message was queued.
+	*/
+	virtual bool SendRoomAnnouncement(const FUniqueNetId& UserId, const FChatRoomId& RoomId, FName Key, const FString& MsgBody) = 0;
+
+	/**
+	* Get statistics for a room's outgoing message queue.
+	*
+	* @param UserId			id of the user in the room
+	* @param RoomId			id of the room.  For Mixer chat this is the owning user name.
+	* @param OutStats		filled in with the current statistics.
+	*
+	* @return				whether or not the room was found.
+	*/
+	virtual bool GetSendQueueStats(const FUniqueNetId& UserId, const FChatRoomId& RoomId, FMixerChatSendQueueStats& OutStats) = 0;
+
+	/**
+	* Replace the words and phrases filtered out of incoming chat in all rooms, e.g. with a list
+	* downloaded at runtime.  Takes precedence over the word list asset in project settings until
+	* that asset is next edited or reloaded.  Messages already received are not affected.
+	*
+	* @param Words				words or phrases to match, ignoring case.  Pass an empty array to stop filtering.
+	* @param bMatchWholeWords	only match entries that are not part of a longer word.
+	*/
+	virtual void SetModerationWordList(const TArray<FString>& Words, bool bMatchWholeWords) = 0;
+
 	DEFINE_ONLINE_DELEGATE_TWO_PARAM(OnChatRoomMessagesCleared, const FUniqueNetId&, const FChatRoomId&);
+	DEFINE_ONLINE_DELEGATE_TWO_PARAM(OnChatRoomHistoryLoaded, const FUniqueNetId&, const FChatRoomId&);
 	DEFINE_ONLINE_DELEGATE_THREE_PARAM(OnChatRoomUserPurged, const FUniqueNetId&, const FChatRoomId&, const FUniqueNetId&);
+	DEFINE_ONLINE_DELEGATE_THREE_PARAM(OnChatRoomMessageDigest, const FUniqueNetId&, const FChatRoomId&, const TArray<TSharedRef<FChatMessage>>&);
 	DEFINE_ONLINE_DELEGATE_THREE_PARAM(OnChatRoomPollStart, const FUniqueNetId&, const FChatRoomId&, const TSharedRef<FChatPollMixer>&);
 	DEFINE_ONLINE_DELEGATE_THREE_PARAM(OnChatRoomPollUpdate, const FUniqueNetId&, const FChatRoomId&, const TSharedRef<FChatPollMixer>&);
 	DEFINE_ONLINE_DELEGATE_THREE_PARAM(OnChatRoomPollEnd, const FUniqueNetId&, const FChatRoomId&, const TSharedRef<FChatPollMixer>&);
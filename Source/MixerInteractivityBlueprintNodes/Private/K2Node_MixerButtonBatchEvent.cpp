@@ -0,0 +1,115 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+
+#include "K2Node_MixerButtonBatchEvent.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EditorCategoryUtils.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "GraphEditorSettings.h"
+#include "KismetCompiler.h"
+#include "MixerDynamicDelegateBinding.h"
+#include "MixerInteractivitySettings.h"
+#include "MixerInteractivityJsonTypes.h"
+#include "MixerInteractivityProjectAsset.h"
+
+#define LOCTEXT_NAMESPACE "MixerInteractivityEditor"
+
+void UK2Node_MixerButtonBatchEvent::ValidateNodeDuringCompilation(class FCompilerResultsLog& MessageLog) const
+{
+	Super::ValidateNodeDuringCompilation(MessageLog);
+
+	TArray<FString> Buttons;
+	UMixerInteractivitySettings::GetAllControls(FMixerInteractiveControl::ButtonKind, Buttons);
+	if (!Buttons.Contains(ButtonId.ToString()))
+	{
+		MessageLog.Warning(*FText::Format(LOCTEXT("MixerButtonBatchNode_UnknownButtonWarning", "Mixer Button Batch Event specifies invalid button id '{0}' for @@"), FText::FromName(ButtonId)).ToString(), this);
+	}
+}
+
+void UK2Node_MixerButtonBatchEvent::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	auto CustomizeMixerNodeLambda = [](UEdGraphNode* NewNode, bool bIsTemplateNode, FString ButtonName, bool bPressed)
+	{
+		UK2Node_MixerButtonBatchEvent* MixerNode = CastChecked<UK2Node_MixerButtonBatchEvent>(NewNode);
+		MixerNode->ButtonId = *ButtonName;
+		MixerNode->Pressed = bPressed;
+		MixerNode->CustomFunctionName = FName(*FString::Printf(TEXT("MixerButtonBatchEvt_%s_%s"), *ButtonName, bPressed ? TEXT("Pressed") : TEXT("Released")));
+		MixerNode->EventReference.SetExternalDelegateMember(FName(TEXT("MixerButtonBatchEventDynamicDelegate__DelegateSignature")));
+	};
+
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		TArray<FString> Buttons;
+		UMixerInteractivitySettings::GetAllControls(FMixerInteractiveControl::ButtonKind, Buttons);
+		for (const FString& ButtonName : Buttons)
+		{
+			for (bool bPressed : { true, false })
+			{
+				UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+				NodeSpawner->CustomizeNodeDelegate = UBlueprintNodeSpawner::FCustomizeNodeDelegate::CreateStatic(CustomizeMixerNodeLambda, ButtonName, bPressed);
+				ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+			}
+		}
+	}
+}
+
+FText UK2Node_MixerButtonBatchEvent::GetMenuCategory() const
+{
+	return LOCTEXT("MixerButtonBatchNode_MenuCategory", "{MixerInteractivity}|Button Events");
+}
+
+FText UK2Node_MixerButtonBatchEvent::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	if (CachedNodeTitle.IsOutOfDate(this))
+	{
+		// FText::Format() is slow, so we cache this to save on performance
+		FText TitleFormat = Pressed ? LOCTEXT("MixerButtonBatchNode_PressedTitle", "{0} pressed batched (Mixer button)") : LOCTEXT("MixerButtonBatchNode_ReleasedTitle", "{0} released batched (Mixer button)");
+		CachedNodeTitle.SetCachedText(FText::Format(TitleFormat, FText::FromName(ButtonId)), this);
+	}
+	return CachedNodeTitle;
+}
+
+FText UK2Node_MixerButtonBatchEvent::GetTooltipText() const
+{
+	if (CachedTooltip.IsOutOfDate(this))
+	{
+		FText TooltipFormat = Pressed ?
+			LOCTEXT("MixerButtonBatchNode_PressedTooltip", "Fires at most once per frame with all presses of the {0} button on Mixer since the previous frame.") :
+			LOCTEXT("MixerButtonBatchNode_ReleasedTooltip", "Fires at most once per frame with all releases of the {0} button on Mixer since the previous frame.");
+		CachedTooltip.SetCachedText(FText::Format(TooltipFormat, FText::FromName(ButtonId)), this);
+	}
+	return CachedTooltip;
+}
+
+FSlateIcon UK2Node_MixerButtonBatchEvent::GetIconAndTint(FLinearColor& OutColor) const
+{
+	return FSlateIcon("EditorStyle", "GraphEditor.PadEvent_16x");
+}
+
+UClass* UK2Node_MixerButtonBatchEvent::GetDynamicBindingClass() const
+{
+	return UMixerDelegateBinding::StaticClass();
+}
+
+void UK2Node_MixerButtonBatchEvent::RegisterDynamicBinding(UDynamicBlueprintBinding* BindingObject) const
+{
+	FMixerButtonEventBinding BindingInfo;
+	BindingInfo.TargetFunctionName = CustomFunctionName;
+	BindingInfo.ButtonId = ButtonId;
+	BindingInfo.Pressed = Pressed;
+	BindingInfo.bBatched = true;
+
+	UMixerDelegateBinding* MixerBindingObject = CastChecked<UMixerDelegateBinding>(BindingObject);
+	MixerBindingObject->AddButtonBinding(BindingInfo);
+}
+
+#undef LOCTEXT_NAMESPACE
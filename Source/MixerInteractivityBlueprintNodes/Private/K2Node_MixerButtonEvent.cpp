@@ -22,6 +22,7 @@ void UK2Node_MixerButtonEvent::RegisterDynamicBinding(UDynamicBlueprintBinding*
 	BindingInfo.TargetFunctionName = CustomFunctionName;
 	BindingInfo.ButtonId = ButtonId;
 	BindingInfo.Pressed = Pressed;
+	BindingInfo.bBatched = false;
 
 	UMixerDelegateBinding* MixerBindingObject =  CastChecked<UMixerDelegateBinding>(BindingObject);
 	MixerBindingObject->AddButtonBinding(BindingInfo);
@@ -0,0 +1,106 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+
+#include "K2Node_MixerStickBatchEvent.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EditorCategoryUtils.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "GraphEditorSettings.h"
+#include "KismetCompiler.h"
+#include "MixerDynamicDelegateBinding.h"
+#include "MixerInteractivitySettings.h"
+#include "MixerInteractivityJsonTypes.h"
+#include "MixerInteractivityProjectAsset.h"
+
+#define LOCTEXT_NAMESPACE "MixerInteractivityEditor"
+
+void UK2Node_MixerStickBatchEvent::ValidateNodeDuringCompilation(class FCompilerResultsLog& MessageLog) const
+{
+	Super::ValidateNodeDuringCompilation(MessageLog);
+
+	TArray<FString> Sticks;
+	UMixerInteractivitySettings::GetAllControls(FMixerInteractiveControl::JoystickKind, Sticks);
+	if (!Sticks.Contains(StickId.ToString()))
+	{
+		MessageLog.Warning(*FText::Format(LOCTEXT("MixerStickBatchNode_UnknownStickWarning", "Mixer Stick Batch Event specifies invalid stick id '{0}' for @@"), FText::FromName(StickId)).ToString(), this);
+	}
+}
+
+void UK2Node_MixerStickBatchEvent::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	auto CustomizeMixerNodeLambda = [](UEdGraphNode* NewNode, bool bIsTemplateNode, FString StickName)
+	{
+		UK2Node_MixerStickBatchEvent* MixerNode = CastChecked<UK2Node_MixerStickBatchEvent>(NewNode);
+		MixerNode->StickId = *StickName;
+		MixerNode->CustomFunctionName = FName(*FString::Printf(TEXT("MixerStickBatchEvt_%s"), *StickName));
+		MixerNode->EventReference.SetExternalDelegateMember(FName(TEXT("MixerStickBatchEventDynamicDelegate__DelegateSignature")));
+	};
+
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		TArray<FString> Sticks;
+		UMixerInteractivitySettings::GetAllControls(FMixerInteractiveControl::JoystickKind, Sticks);
+		for (const FString& StickName : Sticks)
+		{
+			UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+			NodeSpawner->CustomizeNodeDelegate = UBlueprintNodeSpawner::FCustomizeNodeDelegate::CreateStatic(CustomizeMixerNodeLambda, StickName);
+			ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+		}
+	}
+}
+
+FText UK2Node_MixerStickBatchEvent::GetMenuCategory() const
+{
+	return LOCTEXT("MixerStickBatchNode_MenuCategory", "{MixerInteractivity}|Stick Events");
+}
+
+FText UK2Node_MixerStickBatchEvent::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	if (CachedNodeTitle.IsOutOfDate(this))
+	{
+		// FText::Format() is slow, so we cache this to save on performance
+		CachedNodeTitle.SetCachedText(FText::Format(LOCTEXT("MixerStickBatchNode_Title", "{0} batched (Mixer stick)"), FText::FromName(StickId)), this);
+	}
+	return CachedNodeTitle;
+}
+
+FText UK2Node_MixerStickBatchEvent::GetTooltipText() const
+{
+	if (CachedTooltip.IsOutOfDate(this))
+	{
+		CachedTooltip.SetCachedText(FText::Format(LOCTEXT("MixerStickBatchNode_Tooltip", "Fires at most once per frame with all movement of the {0} stick on Mixer since the previous frame."), FText::FromName(StickId)), this);
+	}
+	return CachedTooltip;
+}
+
+FSlateIcon UK2Node_MixerStickBatchEvent::GetIconAndTint(FLinearColor& OutColor) const
+{
+	return FSlateIcon("EditorStyle", "GraphEditor.PadEvent_16x");
+}
+
+UClass* UK2Node_MixerStickBatchEvent::GetDynamicBindingClass() const
+{
+	return UMixerDelegateBinding::StaticClass();
+}
+
+void UK2Node_MixerStickBatchEvent::RegisterDynamicBinding(UDynamicBlueprintBinding* BindingObject) const
+{
+	FMixerGenericEventBinding BindingInfo;
+	BindingInfo.TargetFunctionName = CustomFunctionName;
+	BindingInfo.NameParam = StickId;
+	BindingInfo.BindingType = EMixerGenericEventBindingType::StickBatch;
+
+	UMixerDelegateBinding* MixerBindingObject = CastChecked<UMixerDelegateBinding>(BindingObject);
+	MixerBindingObject->AddGenericBinding(BindingInfo);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,105 @@
+//*********************************************************
+//
+// Copyright (c) Microsoft. All rights reserved.
+// THIS CODE IS PROVIDED *AS IS* WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING ANY
+// IMPLIED WARRANTIES OF FITNESS FOR A PARTICULAR
+// PURPOSE, MERCHANTABILITY, OR NON-INFRINGEMENT.
+//
+//*********************************************************
+#include "K2Node_MixerTextSubmittedBatchEvent.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EditorCategoryUtils.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "GraphEditorSettings.h"
+#include "KismetCompiler.h"
+#include "MixerDynamicDelegateBinding.h"
+#include "MixerInteractivitySettings.h"
+#include "MixerInteractivityJsonTypes.h"
+#include "MixerInteractivityProjectAsset.h"
+
+#define LOCTEXT_NAMESPACE "MixerInteractivityEditor"
+
+void UK2Node_MixerTextSubmittedBatchEvent::ValidateNodeDuringCompilation(class FCompilerResultsLog& MessageLog) const
+{
+	Super::ValidateNodeDuringCompilation(MessageLog);
+
+	TArray<FString> Textboxes;
+	UMixerInteractivitySettings::GetAllControls(FMixerInteractiveControl::TextboxKind, Textboxes);
+	if (!Textboxes.Contains(TextboxId.ToString()))
+	{
+		MessageLog.Warning(*FText::Format(LOCTEXT("MixerTextSubmittedBatchNode_UnknownTextboxWarning", "Mixer Text Submitted Batch Event specifies invalid textbox id '{0}' for @@"), FText::FromName(TextboxId)).ToString(), this);
+	}
+}
+
+void UK2Node_MixerTextSubmittedBatchEvent::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	auto CustomizeMixerNodeLambda = [](UEdGraphNode* NewNode, bool bIsTemplateNode, FString TextboxName)
+	{
+		UK2Node_MixerTextSubmittedBatchEvent* MixerNode = CastChecked<UK2Node_MixerTextSubmittedBatchEvent>(NewNode);
+		MixerNode->TextboxId = *TextboxName;
+		MixerNode->CustomFunctionName = FName(*FString::Printf(TEXT("MixerTextSubmittedBatchEvt_%s"), *TextboxName));
+		MixerNode->EventReference.SetExternalDelegateMember(FName(TEXT("MixerTextSubmittedBatchEventDynamicDelegate__DelegateSignature")));
+	};
+
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		TArray<FString> Textboxes;
+		UMixerInteractivitySettings::GetAllControls(FMixerInteractiveControl::TextboxKind, Textboxes);
+		for (const FString& TextboxName : Textboxes)
+		{
+			UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+			NodeSpawner->CustomizeNodeDelegate = UBlueprintNodeSpawner::FCustomizeNodeDelegate::CreateStatic(CustomizeMixerNodeLambda, TextboxName);
+			ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+		}
+	}
+}
+
+FText UK2Node_MixerTextSubmittedBatchEvent::GetMenuCategory() const
+{
+	return LOCTEXT("MixerTextSubmittedBatchNode_MenuCategory", "{MixerInteractivity}|Textbox Events");
+}
+
+FText UK2Node_MixerTextSubmittedBatchEvent::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	if (CachedNodeTitle.IsOutOfDate(this))
+	{
+		// FText::Format() is slow, so we cache this to save on performance
+		CachedNodeTitle.SetCachedText(FText::Format(LOCTEXT("MixerTextSubmittedBatchNode_Title", "{0} text submitted batched (Mixer textbox)"), FText::FromName(TextboxId)), this);
+	}
+	return CachedNodeTitle;
+}
+
+FText UK2Node_MixerTextSubmittedBatchEvent::GetTooltipText() const
+{
+	if (CachedTooltip.IsOutOfDate(this))
+	{
+		CachedTooltip.SetCachedText(FText::Format(LOCTEXT("MixerTextSubmittedBatchNode_Tooltip", "Fires at most once per frame with all text submitted via the {0} textbox on Mixer since the previous frame."), FText::FromName(TextboxId)), this);
+	}
+	return CachedTooltip;
+}
+
+FSlateIcon UK2Node_MixerTextSubmittedBatchEvent::GetIconAndTint(FLinearColor& OutColor) const
+{
+	return FSlateIcon("EditorStyle", "GraphEditor.PadEvent_16x");
+}
+
+UClass* UK2Node_MixerTextSubmittedBatchEvent::GetDynamicBindingClass() const
+{
+	return UMixerDelegateBinding::StaticClass();
+}
+
+void UK2Node_MixerTextSubmittedBatchEvent::RegisterDynamicBinding(UDynamicBlueprintBinding* BindingObject) const
+{
+	FMixerGenericEventBinding BindingInfo;
+	BindingInfo.TargetFunctionName = CustomFunctionName;
+	BindingInfo.NameParam = TextboxId;
+	BindingInfo.BindingType = EMixerGenericEventBindingType::TextSubmittedBatch;
+
+	UMixerDelegateBinding* MixerBindingObject = CastChecked<UMixerDelegateBinding>(BindingObject);
+	MixerBindingObject->AddGenericBinding(BindingInfo);
+}
+
+#undef LOCTEXT_NAMESPACE